@@ -11,6 +11,8 @@ file(READ ${usf_develop_folder}/usf_traits.hpp          usf_traits_hpp)
 file(READ ${usf_develop_folder}/usf_string_span.hpp     usf_string_span_hpp)
 file(READ ${usf_develop_folder}/usf_string_view.hpp     usf_string_view_hpp)
 file(READ ${usf_develop_folder}/usf_integer.hpp         usf_integer_hpp)
+file(READ ${usf_develop_folder}/usf_bigint.hpp          usf_bigint_hpp)
+file(READ ${usf_develop_folder}/usf_decimal.hpp         usf_decimal_hpp)
 file(READ ${usf_develop_folder}/usf_float.hpp           usf_float_hpp)
 file(READ ${usf_develop_folder}/usf_arg_format.hpp      usf_arg_format_hpp)
 file(READ ${usf_develop_folder}/usf_arg_custom_type.hpp usf_arg_custom_type_hpp)
@@ -57,6 +59,8 @@ file(APPEND ${usf_release_folder}/usf.hpp "${usf_traits_hpp}\n\n")
 file(APPEND ${usf_release_folder}/usf.hpp "${usf_string_span_hpp}\n\n")
 file(APPEND ${usf_release_folder}/usf.hpp "${usf_string_view_hpp}\n\n")
 file(APPEND ${usf_release_folder}/usf.hpp "${usf_integer_hpp}\n\n")
+file(APPEND ${usf_release_folder}/usf.hpp "${usf_bigint_hpp}\n\n")
+file(APPEND ${usf_release_folder}/usf.hpp "${usf_decimal_hpp}\n\n")
 file(APPEND ${usf_release_folder}/usf.hpp "${usf_float_hpp}\n\n")
 file(APPEND ${usf_release_folder}/usf.hpp "${usf_arg_format_hpp}\n\n")
 file(APPEND ${usf_release_folder}/usf.hpp "${usf_arg_custom_type_hpp}\n\n")
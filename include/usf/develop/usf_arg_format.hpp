@@ -53,10 +53,12 @@ class ArgFormat
             kIntegerHex,
             kIntegerOct,
             kIntegerBin,
+            kIntegerRadix,
             kPointer,
             kFloatFixed,
             kFloatScientific,
             kFloatGeneral,
+            kFloatHex,
             kString,
             kInvalid
         };
@@ -65,6 +67,9 @@ class ArgFormat
         // PUBLIC MEMBER FUNCTIONS
         // --------------------------------------------------------------------
 
+        // Empty format spec (same as "{}")
+        constexpr ArgFormat() noexcept = default;
+
         USF_CPP14_CONSTEXPR ArgFormat(usf::BasicStringView<CharT>& fmt, const int arg_count)
         {
             const_iterator it = fmt.cbegin();
@@ -146,7 +151,13 @@ class ArgFormat
                 if(*it >= '0' && *it <= '9')
                 {
                     // Limit width to 255 characters
-                    m_width = parse_positive_small_int(it, 255);
+                    m_width = static_cast<uint8_t>(parse_positive_small_int(it, 255));
+                }
+
+                // Parse group separator
+                if(*it == ',' || *it == '_')
+                {
+                    m_separator = *it++;
                 }
 
                 // Parse precision
@@ -157,7 +168,8 @@ class ArgFormat
                     // Check for a missing/invalid precision specifier.
                     USF_ENFORCE(*it >= '0' && *it <= '9', std::runtime_error);
 
-                    m_precision = static_cast<int8_t>(parse_positive_small_int(it, 127));
+                    // Limit precision to 32767
+                    m_precision = static_cast<int16_t>(parse_positive_small_int(it, 32767));
                 }
 
                 // Parse type
@@ -177,6 +189,11 @@ class ArgFormat
                         case 'B': m_flags |= Flags::kUppercase;    USF_FALLTHROUGH;
                         case 'b': m_type = Type::kIntegerBin;      break;
 
+#if !defined(USF_DISABLE_RADIX_SUPPORT)
+                        case 'R': m_flags |= Flags::kUppercase;    USF_FALLTHROUGH;
+                        case 'r': m_type = Type::kIntegerRadix;
+                                  m_radix = parse_radix(it);       break;
+#endif
                         case 'P': m_flags |= Flags::kUppercase;    USF_FALLTHROUGH;
                         case 'p': m_type = Type::kPointer;         break;
 
@@ -189,6 +206,9 @@ class ArgFormat
                         case 'G': m_flags |= Flags::kUppercase;    USF_FALLTHROUGH;
                         case 'g': m_type = Type::kFloatGeneral;    break;
 
+                        case 'A': m_flags |= Flags::kUppercase;    USF_FALLTHROUGH;
+                        case 'a': m_type = Type::kFloatHex;        break;
+
                         case 's': m_type = Type::kString;          break;
 
                         default : m_type = Type::kInvalid;         break;
@@ -199,9 +219,10 @@ class ArgFormat
 
                 // Validate the read format spec!
 
-                if(fill_zero)
+                if(fill_zero && !(type_is_integer() && m_precision != -1))
                 {
                     // Fill zero flag has precedence over any other alignment and fill character.
+                    // Like printf, it is ignored by integer types with a precision.
                     m_flags = static_cast<uint8_t>((m_flags & (~Flags::kAlignBitmask)) | Flags::kAlignNumeric);
                     m_fill_char = '0';
                 }
@@ -225,10 +246,21 @@ class ArgFormat
                     USF_ENFORCE(type_allow_hash(), std::runtime_error);
                 }
 
+                if(grouping())
+                {
+                    // Digit grouping is only valid for numeric types (except the
+                    // arbitrary radix and hexadecimal floating point types). The
+                    // ',' separator is only valid for decimal and floating point.
+                    USF_ENFORCE(type_is_none() || type_is_integer() || type_is_float(), std::runtime_error);
+                    USF_ENFORCE(m_separator == '_' || !type_is_integer() || type_is_integer_dec(), std::runtime_error);
+                    USF_ENFORCE(!type_is_integer_radix() && !type_is_float_hex(), std::runtime_error);
+                }
+
                 if(m_precision != -1)
                 {
-                    // Precision is only valid for floating point and string types.
-                    USF_ENFORCE(type_is_float() || type_is_string(), std::runtime_error);
+                    // Precision is only valid for floating point, string and integer
+                    // types (minimum number of digits, without digit grouping).
+                    USF_ENFORCE(type_is_float() || type_is_string() || (type_is_integer() && !grouping()), std::runtime_error);
                 }
             }
 
@@ -240,10 +272,11 @@ class ArgFormat
 
         // Writes the alignment (sign, prefix and fill before) for any
         // argument type. Returns the fill counter to write after argument.
-        USF_CPP14_CONSTEXPR int write_alignment(iterator& it, const_iterator end,
-                                                int digits, const bool negative) const
+        // The prefix can be omitted (e.g. for "nan" and "inf").
+        USF_CPP14_CONSTEXPR int write_alignment(iterator& it, const_iterator end, int digits,
+                                                const bool negative, const bool prefix = true) const
         {
-            digits += sign_width(negative) + prefix_width();
+            digits += sign_width(negative) + (prefix ? prefix_width() : 0);
 
             int fill_after = 0;
 
@@ -251,7 +284,7 @@ class ArgFormat
             {
                 USF_ENFORCE(it + digits < end, std::runtime_error);
                 write_sign(it, negative);
-                write_prefix(it);
+                if(prefix) { write_prefix(it); }
             }
             else
             {
@@ -278,7 +311,7 @@ class ArgFormat
                 }
 
                 write_sign(it, negative);
-                write_prefix(it);
+                if(prefix) { write_prefix(it); }
 
                 if(al == Align::kNumeric)
                 {
@@ -294,6 +327,23 @@ class ArgFormat
         inline constexpr int   width    () const noexcept { return static_cast<int>(m_width    );  }
         inline constexpr int   precision() const noexcept { return static_cast<int>(m_precision);  }
         inline constexpr int   index    () const noexcept { return static_cast<int>(m_index    );  }
+        inline constexpr CharT separator() const noexcept { return m_separator;                    }
+        inline constexpr int   radix    () const noexcept { return static_cast<int>(m_radix    );  }
+
+        // Minimum number of digits of an integer argument: the precision (as in
+        // printf, a zero precision prints no digits for a zero value) or, for
+        // zero padded fields without precision, the width without sign and
+        // prefix. The converters write the leading zeros along with the
+        // digits, in a single pass.
+        inline USF_CPP14_CONSTEXPR int min_digits(const bool negative) const noexcept
+        {
+            if(precision() == -1 && align() == Align::kNumeric && m_fill_char == '0' && !grouping())
+            {
+                return width() - sign_width(negative) - prefix_width();
+            }
+
+            return precision();
+        }
 
         inline constexpr Align align() const noexcept { return Align(m_flags & Flags::kAlignBitmask); }
         inline constexpr Sign  sign () const noexcept { return Sign (m_flags & Flags::kSignBitmask ); }
@@ -301,30 +351,33 @@ class ArgFormat
         inline constexpr bool  is_empty () const noexcept { return (m_flags & Flags::kEmpty    ) != 0; }
         inline constexpr bool  hash     () const noexcept { return (m_flags & Flags::kHash     ) != 0; }
         inline constexpr bool  uppercase() const noexcept { return (m_flags & Flags::kUppercase) != 0; }
+        inline constexpr bool  grouping () const noexcept { return m_separator != 0;                 }
 
         inline constexpr bool type_is_none   () const noexcept { return m_type == Type::kNone;    }
         inline constexpr bool type_is_char   () const noexcept { return m_type == Type::kChar;    }
         inline constexpr bool type_is_string () const noexcept { return m_type == Type::kString;  }
         inline constexpr bool type_is_pointer() const noexcept { return m_type == Type::kPointer; }
 
-        inline constexpr bool type_is_integer() const noexcept { return m_type >= Type::kIntegerDec && m_type <= Type::kIntegerBin;   }
-        inline constexpr bool type_is_float  () const noexcept { return m_type >= Type::kFloatFixed && m_type <= Type::kFloatGeneral; }
-        inline constexpr bool type_is_numeric() const noexcept { return m_type >= Type::kIntegerDec && m_type <= Type::kFloatGeneral; }
+        inline constexpr bool type_is_integer() const noexcept { return m_type >= Type::kIntegerDec && m_type <= Type::kIntegerRadix; }
+        inline constexpr bool type_is_float  () const noexcept { return m_type >= Type::kFloatFixed && m_type <= Type::kFloatHex; }
+        inline constexpr bool type_is_numeric() const noexcept { return m_type >= Type::kIntegerDec && m_type <= Type::kFloatHex; }
 
         inline constexpr bool type_is_integer_dec() const noexcept { return m_type == Type::kIntegerDec; }
         inline constexpr bool type_is_integer_hex() const noexcept { return m_type == Type::kIntegerHex; }
         inline constexpr bool type_is_integer_oct() const noexcept { return m_type == Type::kIntegerOct; }
         inline constexpr bool type_is_integer_bin() const noexcept { return m_type == Type::kIntegerBin; }
+        inline constexpr bool type_is_integer_radix() const noexcept { return m_type == Type::kIntegerRadix; }
 
         inline constexpr bool type_is_float_fixed     () const noexcept { return m_type == Type::kFloatFixed;      }
         inline constexpr bool type_is_float_scientific() const noexcept { return m_type == Type::kFloatScientific; }
         inline constexpr bool type_is_float_general   () const noexcept { return m_type == Type::kFloatGeneral;    }
+        inline constexpr bool type_is_float_hex       () const noexcept { return m_type == Type::kFloatHex;        }
 
         inline constexpr bool type_allow_hash() const noexcept
         {
             // Alternative format is valid for hexadecimal (including
             // pointers), octal, binary and all floating point types.
-            return m_type >= Type::kIntegerHex && m_type <= Type::kFloatGeneral;
+            return m_type >= Type::kIntegerHex && m_type <= Type::kFloatHex && m_type != Type::kIntegerRadix;
         }
 
         inline USF_CPP14_CONSTEXPR void default_align_left() noexcept
@@ -378,7 +431,8 @@ class ArgFormat
         {
             // Alternative format is valid for hexadecimal (including
             // pointers), octal, binary and all floating point types.
-            return (!hash() || type_is_float()) ? 0 : type_is_integer_oct() ? 1 : 2;
+            // The hexadecimal floating point type has always prefix.
+            return type_is_float_hex() ? 2 : (!hash() || type_is_float()) ? 0 : type_is_integer_oct() ? 1 : 2;
         }
 
         USF_CPP14_CONSTEXPR void write_sign(iterator& it, const bool negative) const noexcept
@@ -409,7 +463,13 @@ class ArgFormat
         {
             // Alternative format is valid for hexadecimal (including
             // pointers), octal, binary and all floating point types.
-            if(hash() && !type_is_float())
+            // The hexadecimal floating point type has always prefix.
+            if(type_is_float_hex())
+            {
+                *it++ = '0';
+                *it++ = uppercase() ? 'X' : 'x';
+            }
+            else if(hash() && !type_is_float())
             {
                 *it++ = '0';
 
@@ -428,13 +488,13 @@ class ArgFormat
         // PRIVATE STATIC FUNCTIONS
         // --------------------------------------------------------------------
 
-        // Parses the input as a positive integer that fits into a `uint8_t` type. This
+        // Parses the input as a positive integer that fits into a `uint16_t` type. This
         // function assumes that the first character is a digit and terminates parsing
         // at the presence of the first non-digit character or when value overflows.
         static USF_CPP14_CONSTEXPR
-        uint8_t parse_positive_small_int(const_iterator& it, const int max_value)
+        uint16_t parse_positive_small_int(const_iterator& it, const int max_value)
         {
-            assert(max_value < 256);
+            assert(max_value < 65536);
 
             int value = 0;
 
@@ -446,8 +506,23 @@ class ArgFormat
                 USF_ENFORCE(value <= max_value, std::runtime_error);
             }while(*it >= '0' && *it <= '9');
 
-            return static_cast<uint8_t>(value);
+            return static_cast<uint16_t>(value);
+        }
+
+#if !defined(USF_DISABLE_RADIX_SUPPORT)
+        // Parses the base of the arbitrary radix type (range [2, 62]).
+        static USF_CPP14_CONSTEXPR uint8_t parse_radix(const_iterator& it)
+        {
+            // Check for a missing/invalid base specifier.
+            USF_ENFORCE(*it >= '0' && *it <= '9', std::runtime_error);
+
+            const auto base = static_cast<uint8_t>(parse_positive_small_int(it, 62));
+
+            USF_ENFORCE(base >= 2, std::runtime_error);
+
+            return base;
         }
+#endif
 
         static USF_CPP14_CONSTEXPR uint8_t parse_align_flag(const CharT ch) noexcept
         {
@@ -466,10 +541,12 @@ class ArgFormat
         // --------------------------------------------------------------------
 
         CharT   m_fill_char = ' ';
+        CharT   m_separator = 0;
         Type    m_type      = Type::kNone;
         uint8_t m_flags     = Flags::kEmpty;
         uint8_t m_width     =  0;
-         int8_t m_precision = -1;
+        uint8_t m_radix     =  0;
+        int16_t m_precision = -1;
          int8_t m_index     = -1;
 };
 
@@ -11,6 +11,8 @@ namespace usf
 {
 namespace internal
 {
+inline namespace USF_ENGINE_NAMESPACE
+{
 
 template <typename CharT>
 class Argument
@@ -38,6 +40,12 @@ class Argument
         constexpr Argument(const CharT value) noexcept
             : m_char(value), m_type_id(TypeId::kChar) {}
 
+        constexpr Argument(const int16_t value) noexcept
+            : m_int16(value), m_type_id(TypeId::kInt16) {}
+
+        constexpr Argument(const uint16_t value) noexcept
+            : m_uint16(value), m_type_id(TypeId::kUint16) {}
+
         constexpr Argument(const int32_t value) noexcept
             : m_int32(value), m_type_id(TypeId::kInt32) {}
 
@@ -50,12 +58,45 @@ class Argument
         constexpr Argument(const uint64_t value) noexcept
             : m_uint64(value), m_type_id(TypeId::kUint64) {}
 
+#if defined(USF_INT128_SUPPORT)
+        // 128 bit integers are stored by reference to keep the argument size
+        constexpr Argument(const int128_t* value) noexcept
+            : m_int128(value), m_type_id(TypeId::kInt128) {}
+
+        constexpr Argument(const uint128_t* value) noexcept
+            : m_uint128(value), m_type_id(TypeId::kUint128) {}
+
+        constexpr Argument(const BigIntView* value) noexcept
+            : m_bigint(value), m_type_id(TypeId::kBigInt) {}
+#endif
         constexpr Argument(const void* value) noexcept
             : m_pointer(reinterpret_cast<std::uintptr_t>(value)), m_type_id(TypeId::kPointer) {}
 
+        constexpr Argument(const Decimal value) noexcept
+            : m_decimal(value), m_type_id(TypeId::kDecimal) {}
+
 #if !defined(USF_DISABLE_FLOAT_SUPPORT)
+        constexpr Argument(const float value) noexcept
+            : m_float32(value), m_type_id(TypeId::kFloat32) {}
+
         constexpr Argument(const double value) noexcept
             : m_float(value), m_type_id(TypeId::kFloat) {}
+
+        constexpr Argument(const Float16 value) noexcept
+            : m_float16(value), m_type_id(TypeId::kFloat16) {}
+
+        constexpr Argument(const BFloat16 value) noexcept
+            : m_bfloat16(value), m_type_id(TypeId::kBFloat16) {}
+
+        // Extended precision floats are stored by reference to keep the argument size
+#if defined(USF_LONG_DOUBLE_X87) || defined(USF_LONG_DOUBLE_BINARY128)
+        constexpr Argument(const long double* value) noexcept
+            : m_long_double(value), m_type_id(TypeId::kLongDouble) {}
+#endif
+#if defined(USF_FLOAT128_SUPPORT)
+        constexpr Argument(const float128_t* value) noexcept
+            : m_float128(value), m_type_id(TypeId::kFloat128) {}
+#endif
 #endif
         constexpr Argument(const usf::BasicStringView<CharT> value) noexcept
             : m_string(value), m_type_id(TypeId::kString) {}
@@ -71,13 +112,30 @@ class Argument
             {
                 case TypeId::kBool:    format_bool   (it, dst.end(), format, m_bool   ); break;
                 case TypeId::kChar:    format_char   (it, dst.end(), format, m_char   ); break;
+                case TypeId::kInt16:   format_integer(it, dst.end(), format, m_int16  ); break;
+                case TypeId::kUint16:  format_integer(it, dst.end(), format, m_uint16 ); break;
                 case TypeId::kInt32:   format_integer(it, dst.end(), format, m_int32  ); break;
                 case TypeId::kUint32:  format_integer(it, dst.end(), format, m_uint32 ); break;
                 case TypeId::kInt64:   format_integer(it, dst.end(), format, m_int64  ); break;
                 case TypeId::kUint64:  format_integer(it, dst.end(), format, m_uint64 ); break;
+#if defined(USF_INT128_SUPPORT)
+                case TypeId::kInt128:  format_integer(it, dst.end(), format, *m_int128 ); break;
+                case TypeId::kUint128: format_integer(it, dst.end(), format, *m_uint128); break;
+                case TypeId::kBigInt:  format_bigint (it, dst.end(), format, *m_bigint ); break;
+#endif
                 case TypeId::kPointer: format_pointer(it, dst.end(), format, m_pointer); break;
+                case TypeId::kDecimal: format_decimal(it, dst.end(), format, m_decimal); break;
 #if !defined(USF_DISABLE_FLOAT_SUPPORT)
+                case TypeId::kFloat32: format_float  (it, dst.end(), format, m_float32); break;
                 case TypeId::kFloat:   format_float  (it, dst.end(), format, m_float  ); break;
+                case TypeId::kFloat16: format_float  (it, dst.end(), format, m_float16); break;
+                case TypeId::kBFloat16: format_float (it, dst.end(), format, m_bfloat16); break;
+#if defined(USF_LONG_DOUBLE_X87) || defined(USF_LONG_DOUBLE_BINARY128)
+                case TypeId::kLongDouble: format_float(it, dst.end(), format, *m_long_double); break;
+#endif
+#if defined(USF_FLOAT128_SUPPORT)
+                case TypeId::kFloat128:   format_float(it, dst.end(), format, *m_float128   ); break;
+#endif
 #endif
                 case TypeId::kString:  format_string (it, dst.end(), format, m_string ); break;
                 case TypeId::kCustom:  USF_ENFORCE(format.is_empty(), std::runtime_error);
@@ -87,6 +145,35 @@ class Argument
             dst.remove_prefix(it - dst.begin());
         }
 
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+        // --------------------------------------------------------------------
+        // PUBLIC STATIC FUNCTIONS
+        // --------------------------------------------------------------------
+
+        // Writes `scaled` (a value * 10^`precision` rounded, `precision` in
+        // the range [0, 9]) in fixed point format: the integer part of
+        // `ipart_digits` digits, the decimal point if `point` and the
+        // `precision` fraction digits.
+        static void write_float_scaled(iterator& it, const uint64_t scaled, const int precision,
+                                       const int ipart_digits, const bool point) noexcept
+        {
+            const uint64_t ipart = scaled / Integer::pow10_uint32(precision);
+
+            it += ipart_digits;
+            Integer::convert_dec(it, ipart);
+
+            if(point) { *it++ = '.'; }
+
+            if(precision > 0)
+            {
+                it += precision;
+
+                iterator fraction = it;
+                Integer::convert_dec_digits(fraction, scaled - ipart * Integer::pow10_uint32(precision), precision);
+            }
+        }
+#endif
+
     private:
 
         // --------------------------------------------------------------------
@@ -98,11 +185,14 @@ class Argument
         {
             if(format.type_is_none())
             {
+                // Digit grouping is only valid for numeric types.
+                USF_ENFORCE(!format.grouping(), std::runtime_error);
+
                 format_string(it, end, format, value ? "true" : "false", value ? 4 : 5);
             }
             else if(format.type_is_integer())
             {
-                format_integer(it, end, format, static_cast<uint32_t>(value));
+                format_integer(it, end, format, static_cast<uint16_t>(value));
             }
             else
             {
@@ -116,6 +206,9 @@ class Argument
         {
             if(format.type_is_none() || format.type_is_char())
             {
+                // Digit grouping is only valid for numeric types.
+                USF_ENFORCE(!format.grouping(), std::runtime_error);
+
                 // Characters and strings align to left by default.
                 format.default_align_left();
 
@@ -146,39 +239,229 @@ class Argument
             format_integer(it, end, format, uvalue, negative);
         }
 
-        template <typename T, typename std::enable_if<std::is_unsigned<T>::value, bool>::type = true>
+        // Small integers (8 and 16 bit types) keep their width in the argument,
+        // so that the values below 1000 can take the lookup table conversion.
+        static USF_CPP14_CONSTEXPR void format_integer(iterator& it, const_iterator end, const Format& format,
+                                                       const uint16_t value, const bool negative = false)
+        {
+#if !defined(USF_DISABLE_SMALL_INTEGER_LUT)
+            if(value < 1000 && (format.type_is_none() || format.type_is_integer_dec()) && !format.grouping()
+               && Integer::count_digits_small(value) >= format.min_digits(negative) && (value != 0 || format.precision() != 0))
+            {
+                const auto digits = Integer::count_digits_small(value);
+                const int fill_after = format.write_alignment(it, end, digits, negative);
+                Integer::convert_dec_small(it, value, end - it);
+                CharTraits::assign(it, format.fill_char(), fill_after);
+                return;
+            }
+#endif
+            format_integer(it, end, format, static_cast<uint32_t>(value), negative);
+        }
+
+#if defined(USF_INT128_SUPPORT)
+        static USF_CPP14_CONSTEXPR void format_integer(iterator& it, const_iterator end,
+                                                       const Format& format, const int128_t value)
+        {
+            const bool negative = (value < 0);
+            const auto uvalue = static_cast<uint128_t>(value);
+
+            format_integer(it, end, format, negative ? (0 - uvalue) : uvalue, negative);
+        }
+#endif
+
+        template <typename T, typename std::enable_if<is_unsigned_integer<T>::value, bool>::type = true>
         static USF_CPP14_CONSTEXPR void format_integer(iterator& it, const_iterator end, const Format& format,
                                                        const T value, const bool negative = false)
         {
+            const int min_digits = format.min_digits(negative);
+
             int fill_after = 0;
 
-            if(format.type_is_none() || format.type_is_integer_dec())
+            if(value == 0 && format.precision() == 0)
             {
-                const auto digits = Integer::count_digits_dec(value);
-                fill_after = format.write_alignment(it, end, digits, negative);
-                it += digits;
-                Integer::convert_dec(it, value);
+                // Zero precision and zero value: no digits (as in printf)
+                fill_after = format.write_alignment(it, end, 0, negative);
+            }
+            else if(format.type_is_none() || format.type_is_integer_dec())
+            {
+                auto digits = Integer::count_digits_dec(value);
+
+                if(format.grouping())
+                {
+                    digits = Integer::count_grouped(digits, 3);
+
+                    fill_after = format.write_alignment(it, end, digits, negative);
+                    it += digits;
+                    Integer::convert_dec_grouped(it, value, format.separator());
+                }
+                else if(digits < min_digits)
+                {
+                    // Zero padded (fused with the conversion)
+                    fill_after = format.write_alignment(it, end, min_digits, negative);
+                    it += min_digits;
+                    iterator first = it;
+                    Integer::convert_dec_digits(first, value, min_digits);
+                }
+                else
+                {
+                    fill_after = format.write_alignment(it, end, digits, negative);
+                    it += digits;
+                    Integer::convert_dec(it, value);
+                }
             }
             else if(format.type_is_integer_hex())
             {
-                const auto digits = Integer::count_digits_hex(value);
-                fill_after = format.write_alignment(it, end, digits, negative);
-                it += digits;
-                Integer::convert_hex(it, value, format.uppercase());
+                auto digits = Integer::count_digits_hex(value);
+
+                if(format.grouping())
+                {
+                    digits = Integer::count_grouped(digits, 4);
+
+                    fill_after = format.write_alignment(it, end, digits, negative);
+                    it += digits;
+                    Integer::convert_hex_grouped(it, value, format.uppercase(), format.separator());
+                }
+                else if(digits < min_digits)
+                {
+                    // Zero padded (fused with the conversion)
+                    fill_after = format.write_alignment(it, end, min_digits, negative);
+                    it += min_digits;
+                    iterator first = it;
+                    Integer::convert_hex_digits(first, value, min_digits, format.uppercase());
+                }
+                else
+                {
+                    fill_after = format.write_alignment(it, end, digits, negative);
+                    it += digits;
+                    Integer::convert_hex(it, value, format.uppercase());
+                }
             }
             else if(format.type_is_integer_oct())
             {
-                const auto digits = Integer::count_digits_oct(value);
-                fill_after = format.write_alignment(it, end, digits, negative);
+                auto digits = Integer::count_digits_oct(value);
+
+                if(format.grouping())
+                {
+                    digits = Integer::count_grouped(digits, 4);
+
+                    fill_after = format.write_alignment(it, end, digits, negative);
+                    it += digits;
+                    Integer::convert_oct_grouped(it, value, format.separator());
+                }
+                else if(digits < min_digits)
+                {
+                    // Zero padded (fused with the conversion)
+                    fill_after = format.write_alignment(it, end, min_digits, negative);
+                    it += min_digits;
+                    iterator first = it;
+                    Integer::convert_oct_digits(first, value, min_digits);
+                }
+                else
+                {
+                    fill_after = format.write_alignment(it, end, digits, negative);
+                    it += digits;
+                    Integer::convert_oct(it, value);
+                }
+            }
+            else if(format.type_is_integer_bin())
+            {
+                auto digits = Integer::count_digits_bin(value);
+
+                if(format.grouping())
+                {
+                    digits = Integer::count_grouped(digits, 4);
+
+                    fill_after = format.write_alignment(it, end, digits, negative);
+                    it += digits;
+                    Integer::convert_bin_grouped(it, value, format.separator());
+                }
+                else if(digits < min_digits)
+                {
+                    // Zero padded (fused with the conversion)
+                    fill_after = format.write_alignment(it, end, min_digits, negative);
+                    it += min_digits;
+                    iterator first = it;
+                    Integer::convert_bin_digits(first, value, min_digits);
+                }
+                else
+                {
+                    fill_after = format.write_alignment(it, end, digits, negative);
+                    it += digits;
+                    Integer::convert_bin(it, value);
+                }
+            }
+#if !defined(USF_DISABLE_RADIX_SUPPORT)
+            else if(format.type_is_integer_radix())
+            {
+                const auto base = static_cast<unsigned>(format.radix());
+                const auto digits = Integer::count_digits_radix(value, base);
+                const auto zeros = std::max(min_digits - digits, 0);
+                fill_after = format.write_alignment(it, end, digits + zeros, negative);
+                CharTraits::assign(it, '0', zeros);
+                it += digits;
+                Integer::convert_radix(it, value, base, format.uppercase());
+            }
+#endif
+            else
+            {
+                // Argument type / format mismatch
+                USF_CONTRACT_VIOLATION(std::runtime_error);
+            }
+
+            CharTraits::assign(it, format.fill_char(), fill_after);
+        }
+
+#if defined(USF_INT128_SUPPORT)
+        static void format_bigint(iterator& it, const_iterator end, const Format& format, const BigIntView& value)
+        {
+            USF_ENFORCE(value.size() <= BigInt::kMaxLimbs && !format.grouping(), std::runtime_error);
+
+            const uint64_t* limbs = value.limbs();
+            const int count = BigInt::significant_limbs(limbs, static_cast<int>(value.size()));
+            const bool negative = value.negative() && count > 0;
+            const int min_digits = format.min_digits(negative);
+
+            int fill_after = 0;
+
+            if(count == 0 && format.precision() == 0)
+            {
+                // Zero precision and zero value: no digits (as in printf)
+                fill_after = format.write_alignment(it, end, 0, negative);
+            }
+            else if(format.type_is_none() || format.type_is_integer_dec())
+            {
+                // The number of digits is only known after the conversion:
+                // the digits are converted to the end of a local buffer and
+                // copied to the output string after the alignment.
+                char buffer[BigInt::kMaxDigitsDec];
+
+                char* const last = buffer + BigInt::kMaxDigitsDec;
+                const char* const first = BigInt::convert_dec(last, limbs, count);
+
+                const auto digits = static_cast<int>(last - first);
+                const auto zeros = std::max(min_digits - digits, 0);
+
+                fill_after = format.write_alignment(it, end, digits + zeros, negative);
+                CharTraits::assign(it, '0', zeros);
+                CharTraits::copy(it, first, digits);
+            }
+            else if(format.type_is_integer_hex())
+            {
+                const auto digits = BigInt::count_digits_hex(limbs, count);
+                const auto zeros = std::max(min_digits - digits, 0);
+                fill_after = format.write_alignment(it, end, digits + zeros, negative);
+                CharTraits::assign(it, '0', zeros);
                 it += digits;
-                Integer::convert_oct(it, value);
+                BigInt::convert_hex(it, limbs, count, format.uppercase());
             }
             else if(format.type_is_integer_bin())
             {
-                const auto digits = Integer::count_digits_bin(value);
-                fill_after = format.write_alignment(it, end, digits, negative);
+                const auto digits = BigInt::count_digits_bin(limbs, count);
+                const auto zeros = std::max(min_digits - digits, 0);
+                fill_after = format.write_alignment(it, end, digits + zeros, negative);
+                CharTraits::assign(it, '0', zeros);
                 it += digits;
-                Integer::convert_bin(it, value);
+                BigInt::convert_bin(it, limbs, count);
             }
             else
             {
@@ -188,6 +471,7 @@ class Argument
 
             CharTraits::assign(it, format.fill_char(), fill_after);
         }
+#endif
 
         static USF_CPP14_CONSTEXPR void format_pointer(iterator& it, const_iterator end,
                                                        const Format& format, const std::uintptr_t value)
@@ -212,22 +496,134 @@ class Argument
             }
         }
 
-#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+        // Formats a decimal (mantissa * 10^exponent) in fixed point format.
+        // Without precision all the digits are written, otherwise the value
+        // is rounded to `precision` decimals (half away from zero).
+        static USF_CPP14_CONSTEXPR void format_decimal(iterator& it, const_iterator end,
+                                                       const Format& format, const Decimal value)
+        {
+            // Test for argument type / format match
+            USF_ENFORCE(format.type_is_none() || format.type_is_float_fixed(), std::runtime_error);
+
+            const bool negative = value.mantissa() < 0;
+
+            uint64_t mantissa = static_cast<uint64_t>(value.mantissa());
+            if(negative) { mantissa = 0 - mantissa; }
+
+            const int precision = (format.precision() >= 0) ? format.precision() : std::max(-value.exponent(), 0);
+
+            // The digits to write are the mantissa digits followed by `zeros`
+            // zeros. The last `precision` ones are the fractional part.
+            const int shift = value.exponent() + precision;
+            int zeros = 0;
+
+            if(shift >= 0)
+            {
+                zeros = shift;
+            }
+            else if(shift < -19)
+            {
+                // Less than 10^-19 of the last digit (always rounded down)
+                mantissa = 0;
+            }
+            else
+            {
+                const uint64_t pow10 = Integer::pow10_uint64(-shift);
+                const uint64_t remainder = mantissa % pow10;
+
+                mantissa /= pow10;
+
+                if(remainder >= pow10 - remainder) { ++mantissa; }
+            }
+
+            CharT significand[20]; // Not initialized (converted digits only are read)
+            const int significand_size = Integer::count_digits_dec(mantissa);
+            Integer::convert_dec(significand + significand_size, mantissa);
+
+            const int ipart_digits = significand_size + zeros - precision;
+
+            int full_digits = std::max(ipart_digits, 1) + precision + static_cast<int>(precision > 0 || format.hash());
+
+            if(format.grouping() && ipart_digits > 0) { full_digits += (ipart_digits - 1) / 3; }
+
+            const int fill_after = format.write_alignment(it, end, full_digits, negative);
+
+            if(ipart_digits <= 0)
+            {
+                // 0.<0>SIGNIFICAND<0>
+                *it++ = '0';
+                *it++ = '.';
+
+                CharTraits::assign(it, '0', -ipart_digits);
+                CharTraits::copy(it, significand, significand_size);
+                CharTraits::assign(it, '0', zeros);
+            }
+            else
+            {
+                // SIGNIFICAND[0:x]<0><.>SIGNIFICAND[x:N]<0>
+                if(format.grouping())
+                {
+                    write_grouped_ipart(it, significand, significand_size, ipart_digits, format.separator());
+                }
+                else
+                {
+                    const int copy_size = std::min(ipart_digits, significand_size);
+                    CharTraits::copy(it, significand, copy_size);
+                    CharTraits::assign(it, '0', ipart_digits - copy_size);
+                }
+
+                if(precision > 0 || format.hash()) { *it++ = '.'; }
+
+                const int copy_size = std::max(significand_size - ipart_digits, 0);
+                CharTraits::copy(it, significand + ipart_digits, copy_size);
+                CharTraits::assign(it, '0', precision - copy_size);
+            }
+
+            CharTraits::assign(it, format.fill_char(), fill_after);
+        }
+
+        // Writes the `ipart_digits` integer part digits of the significand
+        // (padded with zeros if the significand is shorter), placing the
+        // separator between each group of 3 digits.
         static USF_CPP14_CONSTEXPR
-        void format_float(iterator& it, const_iterator end, const Format& format, double value)
+        void write_grouped_ipart(iterator& it, const CharT* significand, const int significand_size,
+                                 const int ipart_digits, const CharT separator) noexcept
+        {
+            for(int i = 0; i < ipart_digits; ++i)
+            {
+                if(i != 0 && (ipart_digits - i) % 3 == 0) { *it++ = separator; }
+
+                *it++ = (i < significand_size) ? significand[i] : '0';
+            }
+        }
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+        // Formats a float, a double, a 16 bit or an extended precision float.
+        // The fixed precision conversion is the same for the floats exactly
+        // represented as a double, the shortest one is specific to each type.
+        template <typename T> static USF_CPP14_CONSTEXPR
+        void format_float(iterator& it, const_iterator end, const Format& format, T value)
         {
             // Test for argument type / format match
             USF_ENFORCE(format.type_is_none() || format.type_is_float(), std::runtime_error);
 
-            if(std::isnan(value))
+            // Fast path for the common low precision fixed formats
+            if(format.type_is_float_fixed() && !format.grouping() && format_float_scaled(it, end, format, value))
+            {
+                return;
+            }
+
+            const int category = Float::classify(value);
+
+            if(category == FP_NAN)
             {
                 format_string(it, end, format, format.uppercase() ? "NAN" : "nan", 3);
             }
             else
             {
-                const bool negative = std::signbit(value);
+                const bool negative = Float::sign_bit(value);
 
-                if(std::isinf(value))
+                if(category == FP_INFINITE)
                 {
                     format_string(it, end, format, format.uppercase() ? "INF" : "inf", 3, negative);
                 }
@@ -235,154 +631,210 @@ class Argument
                 {
                     if(negative) { value = -value; }
 
-                    struct fp_t
+                    // The general format without precision (and alternative form) uses the shortest representation
+                    const bool shortest = (format.type_is_none() || format.type_is_float_general()) && format.precision() < 0 && !format.hash();
+
+                    if(format.type_is_float_hex())
                     {
-                        union
+                        format_float_hex(it, end, format, value, negative);
+                    }
+                    else if(category == FP_ZERO)
+                    {
+                        format_float_zero(it, end, format, negative);
+                    }
+                    else
+                    {
+                        // Small buffer for the shortest and the low precision
+                        // conversions, the exact conversion of many digits
+                        // needs a larger one.
+                        CharT significand[Float::kSmallDigits]; // Not initialized (converted digits only are read)
+
+                        if(!format_float_digits(it, end, format, value, negative, shortest, significand, Float::kSmallDigits))
                         {
-                            double   d;
-                            uint64_t i;
-                        };
-                    };
+                            format_float_exact_digits(it, end, format, value, negative);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Converts and writes the value (positive, finite and not zero) with
+        // the `significand` buffer of `max_digits` elements. Returns false
+        // (nothing written) if the conversion needs a larger buffer.
+        template <typename T> static
+        bool format_float_digits(iterator& it, const_iterator end, const Format& format, const T value,
+                                 const bool negative, const bool shortest, CharT* const significand, const int max_digits)
+        {
+            int precision = format.precision();
 
-                    const fp_t fp_value{{value}};
+            bool format_fixed = format.type_is_float_fixed();
 
-                    if(fp_value.i == 0)
+            int exponent = 0;
+            int significand_size = 0;
+
+            if(shortest)
+            {
+                // Shortest round trip representation (fixed point
+                // format for the exponents in the range [-4, 16)).
+                significand_size = Float::convert_shortest(significand, exponent, value);
+
+                format_fixed = (exponent >= -4 && exponent < 16);
+
+                precision = significand_size - 1;
+
+                if(format_fixed) { precision = std::max(precision - exponent, 0); }
+            }
+            else
+            {
+                if(precision < 0) { precision = 6; }
+
+                const bool significant_figures = format.type_is_none() || format.type_is_float_general();
+
+                // General format
+                if(significant_figures && precision > 0) { --precision; }
+
+                significand_size = Float::convert(significand, exponent, value, format_fixed, precision, max_digits);
+
+                if(significand_size == 0) { return false; }
+
+                if(significant_figures)
+                {
+                    if(exponent >= -4 && exponent <= precision)
                     {
-                        format_float_zero(it, end, format, negative);
+                        format_fixed = true;
                     }
-                    else if(value >= 1E-19 && value <= 1.8446744E19)
+
+                    if(!format.hash()) { precision = significand_size - 1; }
+
+                    if(format_fixed)
                     {
-                        int precision = format.precision();
+                        precision = std::max(precision - exponent, 0);
+                    }
+                }
+            }
 
-                        if(precision < 0) { precision = 6; }
+            int fill_after = 0;
 
-                        bool format_fixed = format.type_is_float_fixed();
-                        bool significant_figures = false;
+            if(format_fixed)
+            {
+                // Fixed point format
+                if(exponent < 0)
+                {
+                    // 0.<0>SIGNIFICAND[0:N]<0>
 
-                        if(format.type_is_none() || format.type_is_float_general())
-                        {
-                            // General format
-                            significant_figures = true;
+                    const int full_digits = precision + 2;
+                    fill_after = format.write_alignment(it, end, full_digits, negative);
 
-                            if(precision > 0) { --precision; }
-                        }
+                    *it++ = '0';
+                    *it++ = '.';
 
-                        CharT significand[36]{}; // 34 characters should be the maximum size needed
-                        int exponent = 0;
+                    int zero_digits = -exponent - 1;
+                    CharTraits::assign(it, '0', zero_digits);
+                    CharTraits::copy(it, significand, significand_size);
 
-                        const auto significand_size = Float::convert(significand, exponent, value, format_fixed, precision);
+                    // Padding is needed if conversion function removes trailing zeros.
+                    zero_digits = precision - zero_digits - significand_size;
+                    CharTraits::assign(it, '0', zero_digits);
+                }
+                else
+                {
+                    const int ipart_digits = exponent + 1;
 
-                        if(significant_figures)
-                        {
-                            if(exponent >= -4 && exponent <= precision)
-                            {
-                                format_fixed = true;
-                            }
+                    int full_digits = ipart_digits + precision + static_cast<int>(precision > 0 || format.hash());
 
-                            if(!format.hash()) { precision = significand_size - 1; }
+                    if(format.grouping()) { full_digits += (ipart_digits - 1) / 3; }
 
-                            if(format_fixed)
-                            {
-                                precision -= exponent;
-                            }
-                        }
+                    fill_after = format.write_alignment(it, end, full_digits, negative);
+
+                    if(format.grouping())
+                    {
+                        // SIG,NIF,ICA,ND<0>.<0>
 
-                        int fill_after = 0;
+                        write_grouped_ipart(it, significand, significand_size, ipart_digits, format.separator());
 
-                        if(format_fixed)
+                        if(precision > 0 || format.hash())
                         {
-                            // Fixed point format
-                            if(exponent < 0)
-                            {
-                                // 0.<0>SIGNIFICAND[0:N]<0>
-
-                                const int full_digits = precision + 2;
-                                fill_after = format.write_alignment(it, end, full_digits, negative);
-
-                                *it++ = '0';
-                                *it++ = '.';
-
-                                int zero_digits = -exponent - 1;
-                                CharTraits::assign(it, '0', zero_digits);
-                                CharTraits::copy(it, significand, significand_size);
-
-                                // Padding is needed if conversion function removes trailing zeros.
-                                zero_digits = precision - zero_digits - significand_size;
-                                CharTraits::assign(it, '0', zero_digits);
-                            }
-                            else
-                            {
-                                const int full_digits = exponent + 1 + precision + static_cast<int>(precision > 0 || format.hash());
-                                fill_after = format.write_alignment(it, end, full_digits, negative);
-
-                                const int ipart_digits = exponent + 1;
-
-                                if(ipart_digits >= significand_size)
-                                {
-                                    // [SIGNIFICAND]<0><.><0>
-
-                                    CharTraits::copy(it, significand, significand_size);
-                                    CharTraits::assign(it, '0', ipart_digits - significand_size);
-
-                                    if(precision > 0 || format.hash())
-                                    {
-                                        *it++ = '.';
-                                    }
-
-                                    if(precision > 0)
-                                    {
-                                        CharTraits::assign(it, '0', precision);
-                                    }
-                                }
-                                else
-                                {
-                                    // SIGNIFICAND[0:x].SIGNIFICAND[x:N]<0>
-
-                                    CharTraits::copy(it, significand, ipart_digits);
-                                    *it++ = '.';
-
-                                    const int copy_size = significand_size - ipart_digits;
-                                    CharTraits::copy(it, significand + ipart_digits, copy_size);
-
-                                    // Padding is needed if conversion function removes trailing zeros.
-                                    CharTraits::assign(it, '0', precision - copy_size);
-                                }
-                            }
+                            *it++ = '.';
                         }
-                        else
-                        {
-                            // Exponent format
-                            // SIGNIFICAND[0:N]<.>eEXP
-                            // OR
-                            // SIGNIFICAND[0].SIGNIFICAND[1:N]<0>eEXP
-
-                            const int full_digits = 5 + precision + static_cast<int>(precision > 0 || format.hash());
-                            fill_after = format.write_alignment(it, end, full_digits, negative);
 
-                            *it++ = *significand;
+                        const int copy_size = std::max(significand_size - ipart_digits, 0);
+                        CharTraits::copy(it, significand + ipart_digits, copy_size);
 
-                            if(precision > 0 || format.hash())
-                            {
-                                *it++ = '.';
+                        // Padding is needed if conversion function removes trailing zeros.
+                        CharTraits::assign(it, '0', precision - copy_size);
+                    }
+                    else if(ipart_digits >= significand_size)
+                    {
+                        // [SIGNIFICAND]<0><.><0>
 
-                                const int copy_size = significand_size - 1;
-                                CharTraits::copy(it, significand + 1, copy_size);
-                                CharTraits::assign(it, '0', precision - copy_size);
-                            }
+                        CharTraits::copy(it, significand, significand_size);
+                        CharTraits::assign(it, '0', ipart_digits - significand_size);
 
-                            write_float_exponent(it, exponent, format.uppercase());
+                        if(precision > 0 || format.hash())
+                        {
+                            *it++ = '.';
                         }
 
-                        CharTraits::assign(it, format.fill_char(), fill_after);
-
-                        //it += sprintf(it, "[%s] Size:%d Exponent:%d Precision:%d Fixed:%d->", significand, significand_size, exponent, precision, int(format_fixed));
+                        if(precision > 0)
+                        {
+                            CharTraits::assign(it, '0', precision);
+                        }
                     }
                     else
                     {
-                        format_string(it, end, format, format.uppercase() ? "OVF" : "ovf", 3, negative);
+                        // SIGNIFICAND[0:x].SIGNIFICAND[x:N]<0>
+
+                        CharTraits::copy(it, significand, ipart_digits);
+                        *it++ = '.';
+
+                        const int copy_size = significand_size - ipart_digits;
+                        CharTraits::copy(it, significand + ipart_digits, copy_size);
+
+                        // Padding is needed if conversion function removes trailing zeros.
+                        CharTraits::assign(it, '0', precision - copy_size);
                     }
                 }
             }
+            else
+            {
+                // Exponent format
+                // SIGNIFICAND[0:N]<.>eEXP
+                // OR
+                // SIGNIFICAND[0].SIGNIFICAND[1:N]<0>eEXP
+
+                const int full_digits = 2 + float_exponent_width(exponent) + precision
+                                      + static_cast<int>(precision > 0 || format.hash());
+                fill_after = format.write_alignment(it, end, full_digits, negative);
+
+                *it++ = *significand;
+
+                if(precision > 0 || format.hash())
+                {
+                    *it++ = '.';
+
+                    const int copy_size = significand_size - 1;
+                    CharTraits::copy(it, significand + 1, copy_size);
+                    CharTraits::assign(it, '0', precision - copy_size);
+                }
+
+                write_float_exponent(it, exponent, format.uppercase());
+            }
+
+            CharTraits::assign(it, format.fill_char(), fill_after);
+
+            //it += sprintf(it, "[%s] Size:%d Exponent:%d Precision:%d Fixed:%d->", significand, significand_size, exponent, precision, int(format_fixed));
+
+            return true;
+        }
+
+        // Same as above with a buffer for the exact conversion of up to
+        // USF_FLOAT_EXACT_DIGITS digits, only on the stack while needed.
+        template <typename T> USF_NOINLINE static
+        void format_float_exact_digits(iterator& it, const_iterator end, const Format& format, const T value, const bool negative)
+        {
+            CharT significand[Float::kMaxDigits]; // Not initialized (converted digits only are read)
+
+            format_float_digits(it, end, format, value, negative, false, significand, Float::kMaxDigits);
         }
 
         static USF_CPP14_CONSTEXPR
@@ -400,22 +852,137 @@ class Argument
                 *it++ = '+';
             }
 
-            // No point in making a proper integer to string
-            // conversion for exponent since we only support [e-19; e19].
-            assert(exponent <= 19);
+            // At least 2 exponent digits (up to 3 for double, 4 for long double)
+            assert(exponent <= 9999);
 
-            if(exponent < 10)
+            if(exponent >= 1000)
             {
-                *it++ = '0';
-                *it++ = static_cast<CharT>('0' + exponent);
+                *it++ = static_cast<CharT>('0' + exponent / 1000);
+                exponent %= 1000;
+                *it++ = static_cast<CharT>('0' + exponent / 100);
+                exponent %= 100;
             }
-            else
+            else if(exponent >= 100)
             {
-                *it++ = '1';
-                *it++ = static_cast<CharT>('0' + (exponent - 10));
+                *it++ = static_cast<CharT>('0' + exponent / 100);
+                exponent %= 100;
             }
+
+            *it++ = static_cast<CharT>('0' + exponent / 10);
+            *it++ = static_cast<CharT>('0' + exponent % 10);
         }
 
+        // Fixed format with up to 9 decimals of a finite value whose scaled
+        // value fits 52 bits (e.g. below 4.5e12 with 3 decimals): the digits
+        // are the ones of a single correctly rounded multiply by 10^precision.
+        // Returns false (nothing written) if the generic conversion is needed.
+        static bool format_float_scaled(iterator& it, const_iterator end, const Format& format, const double value)
+        {
+            const int precision = (format.precision() < 0) ? 6 : format.precision();
+
+            uint64_t scaled = 0;
+
+            if(precision > 9 || !Float::round_scaled(scaled, std::fabs(value), precision)) { return false; }
+
+            const int ipart_digits = Integer::count_digits_dec(scaled / Integer::pow10_uint32(precision));
+
+            const bool point = precision > 0 || format.hash();
+
+            const int fill_after = format.write_alignment(it, end, ipart_digits + static_cast<int>(point) + precision,
+                                                          std::signbit(value));
+
+            write_float_scaled(it, scaled, precision, ipart_digits, point);
+
+            CharTraits::assign(it, format.fill_char(), fill_after);
+
+            return true;
+        }
+
+        static bool format_float_scaled(iterator& it, const_iterator end, const Format& format, const float value)
+        {
+            return format_float_scaled(it, end, format, static_cast<double>(value));
+        }
+
+        // The other types have no fast path
+        template <typename T> static
+        bool format_float_scaled(iterator&, const_iterator, const Format&, const T) { return false; }
+
+        // Number of exponent digits (sign included)
+        static constexpr int float_exponent_width(const int exponent) noexcept
+        {
+            return (exponent <= -1000 || exponent >= 1000) ? 5
+                 : (exponent <= -100  || exponent >= 100 ) ? 4 : 3;
+        }
+
+        // Hexadecimal format: <0x>DIGIT<.>FRACTION<0>p[+-]EXP
+        template <typename T> static
+        void format_float_hex(iterator& it, const_iterator end, const Format& format, const T value, const bool negative)
+        {
+            uint64_t significand = 0;
+
+            const int exponent = Float::convert_hex(significand, value, format.precision());
+
+            // Fraction digits (trailing zeros removed if no precision specified)
+            int fraction_digits = format.precision();
+
+            if(fraction_digits < 0)
+            {
+                uint64_t fraction = significand & ((UINT64_C(1) << 52U) - 1);
+
+                for(fraction_digits = 13; fraction_digits > 0 && (fraction & 0xF) == 0; --fraction_digits)
+                {
+                    fraction >>= 4U;
+                }
+            }
+
+            const auto exponent_abs = static_cast<uint32_t>(exponent < 0 ? -exponent : exponent);
+            const int  exponent_digits = Integer::count_digits_dec(exponent_abs);
+
+            const int full_digits = 1 + static_cast<int>(fraction_digits > 0 || format.hash())
+                                  + fraction_digits + 2 + exponent_digits;
+
+            const int fill_after = format.write_alignment(it, end, full_digits, negative);
+
+            const char hex_a = format.uppercase() ? 'A' : 'a';
+
+            *it++ = static_cast<CharT>('0' + (significand >> 52U));
+
+            if(fraction_digits > 0 || format.hash()) { *it++ = '.'; }
+
+            const int copy_size = std::min(fraction_digits, 13);
+
+            for(int i = 0; i < copy_size; ++i)
+            {
+                const auto nibble = static_cast<int>((significand >> static_cast<unsigned>(48 - 4 * i)) & 0xF);
+
+                *it++ = static_cast<CharT>(nibble < 10 ? '0' + nibble : hex_a + nibble - 10);
+            }
+
+            CharTraits::assign(it, '0', fraction_digits - copy_size);
+
+            *it++ = format.uppercase() ? 'P' : 'p';
+            *it++ = (exponent < 0) ? '-' : '+';
+
+            it += exponent_digits;
+            Integer::convert_dec(it, exponent_abs);
+
+            CharTraits::assign(it, format.fill_char(), fill_after);
+        }
+
+#if defined(USF_LONG_DOUBLE_X87) || defined(USF_LONG_DOUBLE_BINARY128)
+        // Hexadecimal format not supported for the extended precision floats
+        static void format_float_hex(iterator&, const_iterator, const Format&, const long double, const bool)
+        {
+            USF_CONTRACT_VIOLATION(std::runtime_error);
+        }
+#endif
+#if defined(USF_FLOAT128_SUPPORT)
+        static void format_float_hex(iterator&, const_iterator, const Format&, const float128_t, const bool)
+        {
+            USF_CONTRACT_VIOLATION(std::runtime_error);
+        }
+#endif
+
         static USF_CPP14_CONSTEXPR
         void format_float_zero(iterator& it, const_iterator end, const Format& format, const bool negative)
         {
@@ -458,7 +1025,7 @@ class Argument
                                                       Format& format, const usf::BasicStringView<CharT>& str)
         {
             // Test for argument type / format match
-            USF_ENFORCE(format.type_is_none() || format.type_is_string(), std::runtime_error);
+            USF_ENFORCE((format.type_is_none() && !format.grouping()) || format.type_is_string(), std::runtime_error);
 
             // Characters and strings align to left by default.
             format.default_align_left();
@@ -477,7 +1044,8 @@ class Argument
                                                       const Format& format, const CharSrc* str,
                                                       const int str_length, const bool negative = false)
         {
-            const int fill_after = format.write_alignment(it, end, str_length, negative);
+            // No prefix for strings, "nan" and "inf" (even in hexadecimal floating point format)
+            const int fill_after = format.write_alignment(it, end, str_length, negative, false);
 
             CharTraits::copy(it, str, str_length);
             CharTraits::assign(it, format.fill_char(), fill_after);
@@ -491,13 +1059,30 @@ class Argument
         {
             kBool = 0,
             kChar,
+            kInt16,
+            kUint16,
             kInt32,
             kUint32,
             kInt64,
             kUint64,
+#if defined(USF_INT128_SUPPORT)
+            kInt128,
+            kUint128,
+            kBigInt,
+#endif
             kPointer,
+            kDecimal,
 #if !defined(USF_DISABLE_FLOAT_SUPPORT)
+            kFloat32,
             kFloat,
+            kFloat16,
+            kBFloat16,
+#if defined(USF_LONG_DOUBLE_X87) || defined(USF_LONG_DOUBLE_BINARY128)
+            kLongDouble,
+#endif
+#if defined(USF_FLOAT128_SUPPORT)
+            kFloat128,
+#endif
 #endif
             kString,
             kCustom
@@ -507,13 +1092,30 @@ class Argument
         {
             bool                            m_bool;
             CharT                           m_char;
+            int16_t                         m_int16;
+            uint16_t                        m_uint16;
             int32_t                         m_int32;
             uint32_t                        m_uint32;
             int64_t                         m_int64;
             uint64_t                        m_uint64;
+#if defined(USF_INT128_SUPPORT)
+            const int128_t*                 m_int128;
+            const uint128_t*                m_uint128;
+            const BigIntView*               m_bigint;
+#endif
             std::uintptr_t                  m_pointer;
+            Decimal                         m_decimal;
 #if !defined(USF_DISABLE_FLOAT_SUPPORT)
+            float                           m_float32;
             double                          m_float;
+            Float16                         m_float16;
+            BFloat16                        m_bfloat16;
+#if defined(USF_LONG_DOUBLE_X87) || defined(USF_LONG_DOUBLE_BINARY128)
+            const long double*              m_long_double;
+#endif
+#if defined(USF_FLOAT128_SUPPORT)
+            const float128_t*               m_float128;
+#endif
 #endif
             usf::BasicStringView<CharT>     m_string;
             ArgCustomType<CharT>            m_custom;
@@ -551,28 +1153,28 @@ Argument<CharT> make_argument(const CharT arg)
 template <typename CharT> inline USF_CPP14_CONSTEXPR
 Argument<CharT> make_argument(const int8_t arg)
 {
-    return static_cast<int32_t>(arg);
+    return static_cast<int16_t>(arg);
 }
 
 // 8 bit unsigned integer
 template <typename CharT> inline USF_CPP14_CONSTEXPR
 Argument<CharT> make_argument(const uint8_t arg)
 {
-    return static_cast<uint32_t>(arg);
+    return static_cast<uint16_t>(arg);
 }
 
 // 16 bit signed integer
 template <typename CharT> inline USF_CPP14_CONSTEXPR
 Argument<CharT> make_argument(const int16_t arg)
 {
-    return static_cast<int32_t>(arg);
+    return arg;
 }
 
 // 16 bit unsigned integer
 template <typename CharT> inline USF_CPP14_CONSTEXPR
 Argument<CharT> make_argument(const uint16_t arg)
 {
-    return static_cast<uint32_t>(arg);
+    return arg;
 }
 
 // 32 bit signed integer
@@ -632,6 +1234,46 @@ Argument<CharT> make_argument(const uint64_t arg)
     return arg;
 }
 
+#if defined(USF_INT128_SUPPORT)
+// 128 bit signed integer
+template <typename CharT> inline USF_CPP14_CONSTEXPR
+Argument<CharT> make_argument(const int128_t& arg)
+{
+    if(static_cast<int64_t>(arg) == arg)
+    {
+        return make_argument<CharT>(static_cast<int64_t>(arg));
+    }
+
+    return &arg;
+}
+
+// 128 bit unsigned integer
+template <typename CharT> inline USF_CPP14_CONSTEXPR
+Argument<CharT> make_argument(const uint128_t& arg)
+{
+    if(static_cast<uint64_t>(arg >> 64U) == 0)
+    {
+        return make_argument<CharT>(static_cast<uint64_t>(arg));
+    }
+
+    return &arg;
+}
+
+// Arbitrary precision integer (stored by reference)
+template <typename CharT> inline USF_CPP14_CONSTEXPR
+Argument<CharT> make_argument(const BigIntView& arg)
+{
+    return &arg;
+}
+#endif // defined(USF_INT128_SUPPORT)
+
+// Decimal (scaled integer)
+template <typename CharT> inline USF_CPP14_CONSTEXPR
+Argument<CharT> make_argument(const Decimal arg)
+{
+    return arg;
+}
+
 // Pointer (void*)
 template <typename CharT> inline USF_CPP14_CONSTEXPR
 Argument<CharT> make_argument(void* arg)
@@ -651,7 +1293,7 @@ Argument<CharT> make_argument(const void* arg)
 template <typename CharT> inline USF_CPP14_CONSTEXPR
 Argument<CharT> make_argument(float arg)
 {
-    return static_cast<double>(arg);
+    return arg;
 }
 
 // Floating point (double)
@@ -660,6 +1302,40 @@ Argument<CharT> make_argument(double arg)
 {
     return arg;
 }
+
+// Floating point (IEEE binary16)
+template <typename CharT> inline USF_CPP14_CONSTEXPR
+Argument<CharT> make_argument(const Float16 arg)
+{
+    return arg;
+}
+
+// Floating point (bfloat16)
+template <typename CharT> inline USF_CPP14_CONSTEXPR
+Argument<CharT> make_argument(const BFloat16 arg)
+{
+    return arg;
+}
+
+// Floating point (long double, same as double if not extended)
+template <typename CharT> inline USF_CPP14_CONSTEXPR
+Argument<CharT> make_argument(const long double& arg)
+{
+#if defined(USF_LONG_DOUBLE_X87) || defined(USF_LONG_DOUBLE_BINARY128)
+    return &arg;
+#else
+    return static_cast<double>(arg);
+#endif
+}
+
+#if defined(USF_FLOAT128_SUPPORT)
+// Floating point (__float128)
+template <typename CharT> inline USF_CPP14_CONSTEXPR
+Argument<CharT> make_argument(const float128_t& arg)
+{
+    return &arg;
+}
+#endif
 #endif // !defined(USF_DISABLE_FLOAT_SUPPORT)
 
 // String (convertible to string view)
@@ -670,6 +1346,7 @@ inline USF_CPP14_CONSTEXPR Argument<CharT> make_argument(const T& arg)
     return usf::BasicStringView<CharT>(arg);
 }
 
+} // inline namespace USF_ENGINE_NAMESPACE
 } // namespace internal
 
 // User-defined custom type formatter forward declaration
@@ -681,6 +1358,8 @@ struct Formatter
 
 namespace internal
 {
+inline namespace USF_ENGINE_NAMESPACE
+{
 
 // User-defined custom type
 template <typename CharT, typename T,
@@ -692,6 +1371,7 @@ inline USF_CPP14_CONSTEXPR Argument<CharT> make_argument(const T& arg)
     return ArgCustomType<CharT>::template create<_T, &usf::Formatter<CharT, _T>::format_to>(&arg);
 }
 
+} // inline namespace USF_ENGINE_NAMESPACE
 } // namespace internal
 } // namespace usf
 
@@ -0,0 +1,397 @@
+// ----------------------------------------------------------------------------
+// @file    usf_bigint.hpp
+// @brief   Arbitrary precision integer view and conversion functions.
+// @date    16 October 2026
+// ----------------------------------------------------------------------------
+
+#ifndef USF_BIGINT_HPP
+#define USF_BIGINT_HPP
+
+// The limb arithmetic is built on the 128 bit integers: not available when
+// the compiler doesn't provide them (e.g. MSVC).
+#if defined(USF_INT128_SUPPORT)
+
+namespace usf
+{
+
+// ----------------------------------------------------------------------------
+// Non-owning view of an arbitrary precision integer, made of 64 bit limbs
+// in little-endian order (least significant limb first) and a sign.
+// ----------------------------------------------------------------------------
+class BigIntView
+{
+    public:
+
+        // --------------------------------------------------------------------
+        // PUBLIC MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        constexpr BigIntView(const uint64_t* limbs, const std::size_t count, const bool negative = false) noexcept
+            : m_limbs{limbs}, m_count{count}, m_negative{negative} {}
+
+        template <std::size_t N>
+        constexpr BigIntView(const uint64_t (&limbs)[N]) noexcept
+            : m_limbs{limbs}, m_count{N}, m_negative{false} {}
+
+        constexpr const uint64_t* limbs   () const noexcept { return m_limbs;    }
+        constexpr std::size_t     size    () const noexcept { return m_count;    }
+        constexpr bool            negative() const noexcept { return m_negative; }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER VARIABLES
+        // --------------------------------------------------------------------
+
+        const uint64_t* m_limbs;
+        std::size_t     m_count;
+        bool            m_negative;
+};
+
+namespace internal
+{
+
+// Powers 10^(19 * 2^k) for k in [0, 6] (little-endian limbs). The power
+// 10^(19 * 2^k) is 2^k limbs long and starts at the index 2^k - 1.
+constexpr uint64_t pow10_19_pow2_lut[]
+{
+    // 10^19 (1 limb)
+    0x8AC7230489E80000U,
+    // 10^38 (2 limbs)
+    0x098A224000000000U, 0x4B3B4CA85A86C47AU,
+    // 10^76 (4 limbs)
+    0x0000000000000000U, 0x7775A5F171951000U, 0x0764B4ABE8652979U, 0x161BCCA7119915B5U,
+    // 10^152 (8 limbs)
+    0x0000000000000000U, 0x0000000000000000U, 0xD3AD0EEBA1000000U, 0x3E21F7954FE4A741U,
+    0x5F1E32BFFBDC5D1CU, 0xD2D8AF57D5D929CBU, 0xA2FD64B0CCBF84BAU, 0x01E8CA3185DEB719U,
+    // 10^304 (16 limbs)
+    0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+    0xFB41000000000000U, 0x6174834B58BC387CU, 0x50C038EA88265F88U, 0x355E3BED6D2E729CU,
+    0xA879BDD799C4488FU, 0x51BACAB484A08216U, 0xC9F326D45CC68E49U, 0x44F2A6A7B2F7FCBDU,
+    0xDAE730AF9E224C74U, 0x81A5B7F53B009592U, 0x0FF51F1AE0BBCCA8U, 0x0003A5437C8091F2U,
+    // 10^608 (32 limbs)
+    0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+    0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+    0x0000000000000000U, 0xCD90868100000000U, 0xD995E880AEDAA268U, 0xB784B43DA5A9AEF0U,
+    0xF263079A4188C2BAU, 0x6A5C49B340A88EE5U, 0x6D2D81B712A80DBFU, 0x5CE6B1B1CA05CE6BU,
+    0x0D965D5BF0075D6FU, 0x2C26118C407F1C58U, 0x1675EDAB10C46EFDU, 0x8707615CD6A6E601U,
+    0x4C81799C5B0B2EDAU, 0xC2D8E74C447413E7U, 0x4EC34714FEC04AA7U, 0xCD8318510A8695CFU,
+    0xE84CC7CBA6A67297U, 0x2C901FA7302978DEU, 0xDF9990CC0A0D3514U, 0x6B3DD5319C42EA3DU,
+    0xE35F08BAA089C0DFU, 0x8251F105062F7A80U, 0x8FA79AF9D3C1B861U, 0x0000000D4A44FB4BU,
+    // 10^1216 (64 limbs)
+    0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+    0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+    0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+    0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U,
+    0x0000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x046D55D231CB4D01U,
+    0x191229064171B10FU, 0x9CDB68C18E83E312U, 0xB7FFC0B789B8FFCDU, 0x4B958B6005D0A970U,
+    0xAE152D3E1EEC74F8U, 0xD5C50C5105936CF5U, 0x41C09569A9DC6A06U, 0x34A827A71A50E044U,
+    0x1FEEBC831FDB6805U, 0xB493B83136896F86U, 0x2B1AABB1B9D9F3CAU, 0x2D6623C263CEBEADU,
+    0x814ED646CA672CA8U, 0x59ABBE2FB1917181U, 0xB3CE02962639A988U, 0x4D9474A4219E8F86U,
+    0x51E6550EDF8123ACU, 0xD879FAB0B1FFCCF3U, 0xB1300DE91861B435U, 0x0DAD44C90CE8E477U,
+    0x8720815D8820820FU, 0x50B4286A20FAF8D6U, 0x93AA2E3900CA40EEU, 0x2E5E61DAB8DB012BU,
+    0x2EE4E367E55CBA4AU, 0x6B445244C4CAB346U, 0x93F17D6346F9254CU, 0x25F844C78C978751U,
+    0xD147EEDF87C0BAAFU, 0xD35CC4E8B75C1ABDU, 0xEB2FA6DCD54F781FU, 0xFEC491695418BD92U,
+    0x797549042207179FU, 0x64D0F79DA8533ED6U, 0xE74D98982218E578U, 0xE3828675170471EBU,
+    0xCB2AEFFF2357870DU, 0xF3E00E160CB6F63EU, 0xF2D8D5C4338F1DE5U, 0xE55892CCDDB68E25U,
+    0xCC5AB963D91B0B38U, 0x6B8897E82CDE8D5EU, 0xA08D798ABCE43602U, 0x00000000000000B0U
+};
+
+class BigInt
+{
+    public:
+
+        // --------------------------------------------------------------------
+        // PUBLIC DEFINITIONS
+        // --------------------------------------------------------------------
+
+        // Maximum supported size (up to 128 limbs: 8192 bits)
+        static constexpr int kMaxLimbs = USF_BIGINT_MAX_LIMBS;
+
+        static_assert(kMaxLimbs >= 1 && kMaxLimbs <= 128, "BigInt: USF_BIGINT_MAX_LIMBS must be in the range [1, 128]!");
+
+        // Maximum number of decimal digits (64 * log10(2) ~= 19.27 per limb)
+        static constexpr int kMaxDigitsDec = ((kMaxLimbs * 64 * 1233) >> 12) + 1;
+
+        // --------------------------------------------------------------------
+        // PUBLIC STATIC FUNCTIONS
+        // --------------------------------------------------------------------
+
+        // Number of limbs without the (most significant) zero limbs.
+        static USF_CPP14_CONSTEXPR int significant_limbs(const uint64_t* limbs, int count) noexcept
+        {
+            while(count > 0 && limbs[count - 1] == 0) { --count; }
+
+            return count;
+        }
+
+        static USF_CPP14_CONSTEXPR int count_digits_bin(const uint64_t* limbs, const int count) noexcept
+        {
+            return (count == 0) ? 1 : ((count - 1) * 64) + Integer::count_digits_bin(limbs[count - 1]);
+        }
+
+        static USF_CPP14_CONSTEXPR int count_digits_hex(const uint64_t* limbs, const int count) noexcept
+        {
+            return (count == 0) ? 1 : ((count - 1) * 16) + Integer::count_digits_hex(limbs[count - 1]);
+        }
+
+        // -------- CONVERTERS ------------------------------------------------
+        // Same as the Integer converters, all the following converters write
+        // the value from back to front. The limbs `count` must be already
+        // stripped of the (most significant) zero limbs.
+
+        // -------- DECIMAL CONVERSION ----------------------------------------
+        // Divide and conquer conversion: the value is divided by the largest
+        // power 10^(19 * 2^k) with at most half of its limbs. The remainder
+        // is converted to exactly 19 * 2^k digits and the quotient to the
+        // digits before it, both recursively. Small values are converted by
+        // repeated division by 10^19 with the 64 bit kernels writing each
+        // 19 digits chunk. Since the number of digits is only known after
+        // the conversion, a pointer to the first digit is returned.
+        // --------------------- ----------------------------------------------
+        template <typename CharT>
+        static CharT* convert_dec(CharT* dst, const uint64_t* limbs, const int count) noexcept
+        {
+            assert(count >= 0 && count <= kMaxLimbs);
+
+            // Working copy of the value followed by the scratch memory used
+            // by the divisions (the peak is about twice the value size).
+            uint64_t work[kMaxLimbs * 4];
+
+            std::copy(limbs, limbs + count, work);
+
+            return convert_dec_recursive(dst, work, count, 0, work + count);
+        }
+
+        // -------- BINARY / HEXADECIMAL CONVERSION ---------------------------
+        // Each limb is dumped with the Integer word parallel kernels.
+        // --------------------- ----------------------------------------------
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_bin(CharT* dst, const uint64_t* limbs, const int count) noexcept
+        {
+            for(int i = 0; i < count - 1; ++i)
+            {
+                Integer::convert_bin_digits(dst, limbs[i], 64);
+            }
+
+            Integer::convert_bin(dst, (count == 0) ? 0 : limbs[count - 1]);
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_hex(CharT* dst, const uint64_t* limbs, const int count, const bool uppercase) noexcept
+        {
+            for(int i = 0; i < count - 1; ++i)
+            {
+                Integer::convert_hex_digits(dst, limbs[i], 16, uppercase);
+            }
+
+            Integer::convert_hex(dst, (count == 0) ? 0 : limbs[count - 1], uppercase);
+        }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE STATIC FUNCTIONS
+        // --------------------------------------------------------------------
+
+        // Converts the value `u` (modified) to exactly `pad` digits or to the
+        // minimum number of digits if `pad` is 0.
+        template <typename CharT>
+        static CharT* convert_dec_recursive(CharT* dst, uint64_t* u, int count, const int pad, uint64_t* scratch) noexcept
+        {
+            count = significant_limbs(u, count);
+
+            // Note: the divisions need at least 2 limbs powers (4+ limbs values)
+            if(count <= 4)
+            {
+                return convert_dec_leaf(dst, u, count, pad);
+            }
+
+            // Largest power 10^(19 * 2^k) with 2^k <= count / 2 limbs
+            const int k = 30 - __builtin_clz(static_cast<uint32_t>(count));
+            const int pow_count = 1 << k;
+
+            assert(k <= 6);
+
+            const uint64_t* pow = pow10_19_pow2_lut + (pow_count - 1);
+
+            // Quotient in the scratch memory and remainder in place
+            uint64_t* q = scratch;
+            const int q_count = count - pow_count + 1;
+
+            divide(q, u, count, pow, pow_count, q + q_count);
+
+            const int pow_digits = 19 << k;
+
+            dst = convert_dec_recursive(dst, u, pow_count, pow_digits, q + q_count);
+
+            return convert_dec_recursive(dst, q, q_count, (pad > 0) ? pad - pow_digits : 0, q + q_count);
+        }
+
+        template <typename CharT>
+        static CharT* convert_dec_leaf(CharT* dst, uint64_t* u, int count, const int pad) noexcept
+        {
+            CharT* const first = dst - pad;
+
+            // 19 digits chunks
+            while(count > 1 || (count == 1 && u[0] >= Integer::pow10_uint64(19)))
+            {
+                const uint64_t chunk = divide(u, count, Integer::pow10_uint64(19));
+                count = significant_limbs(u, count);
+
+                Integer::convert_dec_digits(dst, chunk, 19);
+            }
+
+            const uint64_t value = (count == 1) ? u[0] : 0;
+
+            if(pad > 0)
+            {
+                const auto zeros = static_cast<int>(dst - first);
+
+                if(zeros > 0) { Integer::convert_dec_digits(dst, value, zeros); }
+            }
+            else
+            {
+                const auto digits = Integer::count_digits_dec(value);
+                Integer::convert_dec(dst, value);
+                dst -= digits;
+            }
+
+            return dst;
+        }
+
+        // Divides `u` (in place) by the single limb `d`. Returns the remainder.
+        static uint64_t divide(uint64_t* u, const int count, const uint64_t d) noexcept
+        {
+            uint64_t r = 0;
+
+            for(int i = count - 1; i >= 0; --i)
+            {
+                const uint128_t n = (static_cast<uint128_t>(r) << 64U) | u[i];
+                u[i] = static_cast<uint64_t>(n / d);
+                r = static_cast<uint64_t>(n % d);
+            }
+
+            return r;
+        }
+
+        // Divides `u` (`u_count` limbs) by `v` (`v_count` >= 2 limbs, most
+        // significant limb not zero, `u_count` >= `v_count`), stores the
+        // quotient (`u_count - v_count + 1` limbs) in `q` and the remainder
+        // in the first `v_count` limbs of `u`. The `scratch` memory must
+        // have `u_count + v_count + 1` limbs.
+        // Based on the code from Hacker's Delight (Knuth's algorithm D):
+        // http://www.hackersdelight.org/hdcodetxt/divmnu64.c.txt
+        static void divide(uint64_t* q, uint64_t* u, const int u_count,
+                           const uint64_t* v, const int v_count, uint64_t* scratch) noexcept
+        {
+            assert(v_count >= 2 && u_count >= v_count && v[v_count - 1] != 0);
+
+            uint64_t* un = scratch;
+            uint64_t* vn = scratch + u_count + 1;
+
+            // Normalize (most significant bit of the divisor set)
+            const auto s = static_cast<unsigned>(__builtin_clzll(v[v_count - 1]));
+
+            un[u_count] = shift_left(un, u, u_count, s);
+            shift_left(vn, v, v_count, s);
+
+            const uint64_t v1 = vn[v_count - 1];
+            const uint64_t v2 = vn[v_count - 2];
+
+            for(int j = u_count - v_count; j >= 0; --j)
+            {
+                // Estimate the quotient limb (at most 2 units too large)
+                const uint128_t n = (static_cast<uint128_t>(un[j + v_count]) << 64U) | un[j + v_count - 1];
+
+                uint128_t qhat = n / v1;
+                uint128_t rhat = n - (qhat * v1);
+
+                while((qhat >> 64U) != 0 || (qhat * v2) > ((rhat << 64U) | un[j + v_count - 2]))
+                {
+                    --qhat;
+                    rhat += v1;
+
+                    if((rhat >> 64U) != 0) { break; }
+                }
+
+                // Multiply and subtract
+                uint64_t carry  = 0;
+                uint64_t borrow = 0;
+
+                for(int i = 0; i < v_count; ++i)
+                {
+                    const uint128_t p = (qhat * vn[i]) + carry;
+                    carry = static_cast<uint64_t>(p >> 64U);
+
+                    un[i + j] = subtract(un[i + j], static_cast<uint64_t>(p), borrow);
+                }
+
+                un[j + v_count] = subtract(un[j + v_count], carry, borrow);
+
+                q[j] = static_cast<uint64_t>(qhat);
+
+                if(borrow != 0)
+                {
+                    // Estimate was 1 unit too large: add back
+                    --q[j];
+
+                    carry = 0;
+
+                    for(int i = 0; i < v_count; ++i)
+                    {
+                        const uint128_t t = static_cast<uint128_t>(un[i + j]) + vn[i] + carry;
+                        un[i + j] = static_cast<uint64_t>(t);
+                        carry = static_cast<uint64_t>(t >> 64U);
+                    }
+
+                    un[j + v_count] += carry;
+                }
+            }
+
+            // Unnormalize the remainder
+            for(int i = 0; i < v_count; ++i)
+            {
+                u[i] = (s == 0) ? un[i] : ((un[i] >> s) | (un[i + 1] << (64U - s)));
+            }
+        }
+
+        // Returns `a - b - borrow` and updates the `borrow` (0 or 1).
+        USF_ALWAYS_INLINE static uint64_t subtract(const uint64_t a, const uint64_t b, uint64_t& borrow) noexcept
+        {
+            const uint64_t t = a - b;
+            const uint64_t r = t - borrow;
+
+            borrow = static_cast<uint64_t>(a < b) | static_cast<uint64_t>(t < borrow);
+
+            return r;
+        }
+
+        // Shifts `src` left by `s` bits [0, 63] into `dst`. Returns the bits shifted out.
+        static uint64_t shift_left(uint64_t* dst, const uint64_t* src, const int count, const unsigned s) noexcept
+        {
+            if(s == 0)
+            {
+                std::copy(src, src + count, dst);
+                return 0;
+            }
+
+            const uint64_t out = src[count - 1] >> (64U - s);
+
+            for(int i = count - 1; i > 0; --i)
+            {
+                dst[i] = (src[i] << s) | (src[i - 1] >> (64U - s));
+            }
+
+            dst[0] = src[0] << s;
+
+            return out;
+        }
+};
+
+} // namespace internal
+} // namespace usf
+
+#endif // defined(USF_INT128_SUPPORT)
+
+#endif // USF_BIGINT_HPP
@@ -10,12 +10,15 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cfloat>
 #include <climits>
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 // ----------------------------------------------------------------------------
 // usflib configuration options
@@ -24,6 +27,51 @@
 // Configuration of floating point support.
 // USF_DISABLE_FLOAT_SUPPORT           : disables the support of floating point types (it will save considerable code size)
 
+// Configuration of floating point conversion engine (float and double shortest and fixed precision conversions).
+// USF_FLOAT_ENGINE                    : fast    - Ryu with full lookup tables (about 11 kB of tables, default)
+//                                       compact - Ryu with the tables computed from every 26th entry (about 0.8 kB)
+//                                       exact   - multiple precision arithmetic only (no double tables, much slower)
+//                                       The engine code has its own inline namespace, so each translation unit can
+//                                       select a different engine (e.g. -DUSF_FLOAT_ENGINE=compact)
+
+// Configuration of floating point exact conversion.
+// USF_FLOAT_EXACT_DIGITS              : maximum number of significant digits exactly converted by the fixed precision
+//                                       conversion (default 768: all the digits of any double, up to 4966 are needed
+//                                       for the extended precision floats). The following digits are printed as zeros.
+//                                       It sizes the conversion buffer (minimum 20) of the formats needing more than 40
+//                                       digits: 768 * sizeof(CharT) bytes of stack (only in that case)
+
+// Configuration of arbitrary radix integer support.
+// USF_DISABLE_RADIX_SUPPORT           : disables the support of the {:rN} integer type (it will save considerable code size)
+
+// Configuration of small integer conversion.
+// USF_DISABLE_SMALL_INTEGER_LUT       : disables the 4 kB lookup table used to convert the integers below 1000
+
+// Configuration of 128 bit integer support.
+// USF_DISABLE_INT128_SUPPORT          : disables the support of the __int128 / unsigned __int128 types (GCC and Clang only).
+//                                       The usf::BigIntView type is built on them and is only available with this support
+
+// Configuration of arbitrary precision integer support.
+// USF_BIGINT_MAX_LIMBS                : maximum number of 64 bit limbs of a usf::BigIntView argument (default 16: 1024 bits,
+//                                       up to 128: 8192 bits). It sizes the decimal conversion buffers: about 52 bytes of
+//                                       stack per limb (832 bytes by default)
+
+// Configuration of extended precision floating point support.
+// USF_DISABLE_FLOAT128_SUPPORT        : disables the support of the __float128 type (GCC and Clang only). The long double
+//                                       type is always supported: x87 80 bit and IEEE binary128 formats are converted
+//                                       natively, otherwise (same format as double) it is converted as a double
+
+// Configuration of SIMD support.
+// USF_DISABLE_SIMD_SUPPORT            : disables the vectorized (SSE2/SSSE3) conversion paths and uses only the portable ones
+
+// Configuration of format string parse cache.
+// USF_ENABLE_PARSE_CACHE              : enables a per thread cache of the parsed format strings, looked up by their address
+//                                       and length and checked against a copy of their text. Not used by compilers that
+//                                       can't tell a constant evaluation (USF_IS_CONSTANT_EVALUATED)
+// USF_PARSE_CACHE_SIZE                : number of cache entries per thread and char type (power of 2, default 32)
+// USF_PARSE_CACHE_MAX_SPECS           : maximum number of argument specs of a cached format string (default 8)
+// USF_PARSE_CACHE_MAX_LENGTH          : maximum length (in chars) of a cached format string (default 64)
+
 // Configuration of format output string termination option.
 // USF_DISABLE_STRING_TERMINATION      : disables the null termination of the format output string
 
@@ -123,6 +171,28 @@ with the -std=c++11 or -std=gnu++11 compiler options.
 #  define USF_ALWAYS_INLINE  inline
 #endif
 
+// Never inline attribute
+#if defined(USF_COMPILER_GCC) || defined(USF_COMPILER_CLANG)
+#  define USF_NOINLINE  [[gnu::noinline]]
+#elif defined(USF_COMPILER_MSVC)
+#  define USF_NOINLINE  __declspec(noinline)
+#else
+#  define USF_NOINLINE
+#endif
+
+// Constant evaluation detection, for the runtime only paths (SIMD, memcpy,
+// thread locals) of the constexpr functions. Left undefined when the compiler
+// can't tell, and those paths are then not used.
+#if !USF_CPP14_OR_GREATER
+#  define USF_IS_CONSTANT_EVALUATED()  false
+#elif defined(__has_builtin) && !defined(__INTELLISENSE__)
+#  if __has_builtin(__builtin_is_constant_evaluated)
+#    define USF_IS_CONSTANT_EVALUATED()  __builtin_is_constant_evaluated()
+#  endif
+#elif (defined(USF_COMPILER_GCC) && (USF_GCC_VERSION >= 900)) || (defined(USF_COMPILER_MSVC) && (_MSC_VER >= 1925))
+#  define USF_IS_CONSTANT_EVALUATED()  __builtin_is_constant_evaluated()
+#endif
+
 // __has_include() support
 #if defined(__has_include) && !defined(__INTELLISENSE__)
 #  define USF_HAS_INCLUDE(x)  __has_include(x)
@@ -156,6 +226,116 @@ with the -std=c++11 or -std=gnu++11 compiler options.
 #  error "usflib could not determine target architecture."
 #endif
 
+#if (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)) || defined(USF_COMPILER_MSVC)
+#  define USF_TARGET_LITTLE_ENDIAN  1
+#endif
+
+#if defined(__SIZEOF_INT128__) && !defined(USF_DISABLE_INT128_SUPPORT)
+#  define USF_INT128_SUPPORT  1
+#endif
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+#  if defined(__SIZEOF_FLOAT128__) && !defined(USF_DISABLE_FLOAT128_SUPPORT)
+#    define USF_FLOAT128_SUPPORT  1
+#  endif
+#  if (LDBL_MANT_DIG == 64) && (LDBL_MAX_EXP == 16384)
+#    define USF_LONG_DOUBLE_X87  1
+#  elif (LDBL_MANT_DIG == 113)
+#    define USF_LONG_DOUBLE_BINARY128  1
+#  endif
+#  if defined(USF_FLOAT128_SUPPORT) || defined(USF_LONG_DOUBLE_X87) || defined(USF_LONG_DOUBLE_BINARY128)
+#    define USF_FLOAT_EXTENDED_SUPPORT  1
+#  endif
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Floating point conversion engine
+// ----------------------------------------------------------------------------
+#define USF_CONCAT_DETAIL(x, y)  x##y
+#define USF_CONCAT(x, y)         USF_CONCAT_DETAIL(x, y)
+
+#if !defined(USF_FLOAT_ENGINE)
+#  define USF_FLOAT_ENGINE  fast
+#endif
+
+#define USF_FLOAT_ENGINE_ID_compact  1
+#define USF_FLOAT_ENGINE_ID_fast     2
+#define USF_FLOAT_ENGINE_ID_exact    3
+
+#if (USF_CONCAT(USF_FLOAT_ENGINE_ID_, USF_FLOAT_ENGINE) == 1)
+#  define USF_FLOAT_ENGINE_COMPACT  1
+#elif (USF_CONCAT(USF_FLOAT_ENGINE_ID_, USF_FLOAT_ENGINE) == 2)
+#  define USF_FLOAT_ENGINE_FAST     1
+#elif (USF_CONCAT(USF_FLOAT_ENGINE_ID_, USF_FLOAT_ENGINE) == 3)
+#  define USF_FLOAT_ENGINE_EXACT    1
+#else
+#  error "usflib: USF_FLOAT_ENGINE must be compact, fast or exact."
+#endif
+
+// Inline namespace of the code that depends on the engine (the conversion,
+// argument and format functions): the translation units built with different
+// engines (or with and without the parse cache) get distinct definitions
+// instead of violating the ODR.
+#if defined(USF_ENABLE_PARSE_CACHE)
+#  define USF_ENGINE_CACHE_SUFFIX  _cached
+#else
+#  define USF_ENGINE_CACHE_SUFFIX
+#endif
+
+#if defined(USF_DISABLE_FLOAT_SUPPORT)
+#  define USF_ENGINE_NAMESPACE  USF_CONCAT(float_none, USF_ENGINE_CACHE_SUFFIX)
+#else
+#  define USF_ENGINE_NAMESPACE  USF_CONCAT(USF_CONCAT(float_, USF_FLOAT_ENGINE), USF_ENGINE_CACHE_SUFFIX)
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Floating point conversion limits
+// ----------------------------------------------------------------------------
+#if !defined(USF_FLOAT_EXACT_DIGITS)
+#  define USF_FLOAT_EXACT_DIGITS  768
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Arbitrary precision integer limits
+// ----------------------------------------------------------------------------
+#if !defined(USF_BIGINT_MAX_LIMBS)
+#  define USF_BIGINT_MAX_LIMBS  16
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Format string parse cache
+// ----------------------------------------------------------------------------
+#if defined(USF_ENABLE_PARSE_CACHE)
+#  if !defined(USF_PARSE_CACHE_SIZE)
+#    define USF_PARSE_CACHE_SIZE       32
+#  endif
+#  if !defined(USF_PARSE_CACHE_MAX_SPECS)
+#    define USF_PARSE_CACHE_MAX_SPECS  8
+#  endif
+#  if !defined(USF_PARSE_CACHE_MAX_LENGTH)
+#    define USF_PARSE_CACHE_MAX_LENGTH 64
+#  endif
+#endif
+
+
+// ----------------------------------------------------------------------------
+// SIMD instruction set detection
+// ----------------------------------------------------------------------------
+#if !defined(USF_DISABLE_SIMD_SUPPORT)
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#    include <emmintrin.h>
+#    define USF_SIMD_SSE2
+#  endif
+#  if defined(__SSSE3__) || defined(__AVX__)
+#    include <tmmintrin.h>
+#    define USF_SIMD_SSSE3
+#  endif
+#endif
+
 
 // ----------------------------------------------------------------------------
 // Missing intrinsic functions definition for MSVC
@@ -163,7 +343,7 @@ with the -std=c++11 or -std=gnu++11 compiler options.
 #if defined(USF_COMPILER_MSVC)
 #include <intrin.h>
 
-#pragma intrinsic(_BitScanReverse, _BitScanReverse64)
+#pragma intrinsic(_BitScanReverse, _BitScanReverse64, _byteswap_uint64)
 
 int __builtin_clz(uint32_t value)
 {
@@ -176,6 +356,11 @@ int __builtin_clzll(uint64_t value)
     unsigned long leading_zero = 0;
     return _BitScanReverse64(&leading_zero, value) ? static_cast<int>(63 - leading_zero) : 64;
 }
+
+uint64_t __builtin_bswap64(uint64_t value)
+{
+    return _byteswap_uint64(value);
+}
 #endif // defined(USF_COMPILER_MSVC)
 
 
@@ -0,0 +1,45 @@
+// ----------------------------------------------------------------------------
+// @file    usf_decimal.hpp
+// @brief   Scaled integer decimal type (no floating point support needed).
+// @date    16 October 2026
+// ----------------------------------------------------------------------------
+
+#ifndef USF_DECIMAL_HPP
+#define USF_DECIMAL_HPP
+
+namespace usf
+{
+
+// ----------------------------------------------------------------------------
+// Decimal number made of an integer mantissa and a power of 10 exponent
+// (value = mantissa * 10^exponent). E.g. a money amount stored in cents is
+// Decimal(cents, -2). Formatted with the integer conversion only, so it
+// is always exact.
+// ----------------------------------------------------------------------------
+class Decimal
+{
+    public:
+
+        // --------------------------------------------------------------------
+        // PUBLIC MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        constexpr Decimal(const int64_t mantissa, const int8_t exponent = 0) noexcept
+            : m_mantissa{mantissa}, m_exponent{exponent} {}
+
+        constexpr int64_t mantissa() const noexcept { return m_mantissa; }
+        constexpr int     exponent() const noexcept { return m_exponent; }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER VARIABLES
+        // --------------------------------------------------------------------
+
+        int64_t m_mantissa;
+        int8_t  m_exponent;
+};
+
+} // namespace usf
+
+#endif // USF_DECIMAL_HPP
@@ -1,7 +1,9 @@
 // ----------------------------------------------------------------------------
 // @file    usf_float.hpp
-// @brief   Floating point conversion and helper functions. Naive and limited
-//          implementation with the usual precision/rounding errors (good for now).
+// @brief   Floating point conversion and helper functions. The shortest round
+//          trip conversion is exact (Ryu) and the fixed precision conversion
+//          is correctly rounded for any precision (up to the configured
+//          USF_FLOAT_EXACT_DIGITS significant digits).
 // @date    07 January 2019
 // ----------------------------------------------------------------------------
 
@@ -12,63 +14,646 @@
 
 namespace usf
 {
+
+// ----------------------------------------------------------------------------
+// IEEE binary16 (half precision) and bfloat16 values passed by their raw bits
+// (e.g. the elements of a tensor). Formatted natively: the shortest output is
+// the shortest one that parses back to the same 16 bit value.
+// ----------------------------------------------------------------------------
+class Float16
+{
+    public:
+
+        // --------------------------------------------------------------------
+        // PUBLIC MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        constexpr explicit Float16(const uint16_t bits) noexcept : m_bits{bits} {}
+
+        constexpr uint16_t bits() const noexcept { return m_bits; }
+
+        constexpr Float16 operator-() const noexcept { return Float16(static_cast<uint16_t>(m_bits ^ 0x8000U)); }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER VARIABLES
+        // --------------------------------------------------------------------
+
+        uint16_t m_bits;
+};
+
+class BFloat16
+{
+    public:
+
+        // --------------------------------------------------------------------
+        // PUBLIC MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        constexpr explicit BFloat16(const uint16_t bits) noexcept : m_bits{bits} {}
+
+        constexpr uint16_t bits() const noexcept { return m_bits; }
+
+        constexpr BFloat16 operator-() const noexcept { return BFloat16(static_cast<uint16_t>(m_bits ^ 0x8000U)); }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER VARIABLES
+        // --------------------------------------------------------------------
+
+        uint16_t m_bits;
+};
+
 namespace internal
 {
+inline namespace USF_ENGINE_NAMESPACE
+{
+
+#if defined(USF_FLOAT_ENGINE_FAST)
+// Ryu lookup tables: 5^-i (rounded up) and 5^i, both normalized to 125 bits
+// and split in two 64 bit words (low word first). See the paper "Ryu: fast
+// float-to-string conversion" by Ulf Adams (https://github.com/ulfjack/ryu).
+// The 5^i table goes up to 5^341 (Ryu stops at 5^325) to also cover the
+// normalized subnormals of the fixed precision conversion.
+constexpr uint64_t ryu_pow5_inv_split_lut[][2]
+{
+    { 0x0000000000000001U, 0x2000000000000000U }, { 0x999999999999999AU, 0x1999999999999999U },
+    { 0x47AE147AE147AE15U, 0x147AE147AE147AE1U }, { 0x6C8B4395810624DEU, 0x10624DD2F1A9FBE7U },
+    { 0x7A786C226809D496U, 0x1A36E2EB1C432CA5U }, { 0x61F9F01B866E43ABU, 0x14F8B588E368F084U },
+    { 0xB4C7F34938583622U, 0x10C6F7A0B5ED8D36U }, { 0x87A6520EC08D236AU, 0x1AD7F29ABCAF4857U },
+    { 0x9FB841A566D74F88U, 0x15798EE2308C39DFU }, { 0xE62D01511F12A607U, 0x112E0BE826D694B2U },
+    { 0xD6AE6881CB5109A4U, 0x1B7CDFD9D7BDBAB7U }, { 0xDEF1ED34A2A73AEAU, 0x15FD7FE17964955FU },
+    { 0x7F27F0F6E885C8BBU, 0x119799812DEA1119U }, { 0x650CB4BE40D60DF8U, 0x1C25C268497681C2U },
+    { 0xEA70909833DE7193U, 0x16849B86A12B9B01U }, { 0x21F3A6E0297EC143U, 0x1203AF9EE756159BU },
+    { 0x6985D7CD0F313537U, 0x1CD2B297D889BC2BU }, { 0x2137DFD73F5A90F9U, 0x170EF54646D49689U },
+    { 0xE75FE645CC4873FAU, 0x12725DD1D243ABA0U }, { 0xA5663D3C7A0D865DU, 0x1D83C94FB6D2AC34U },
+    { 0x511E976394D79EB1U, 0x179CA10C9242235DU }, { 0xDA7EDF82DD794BC1U, 0x12E3B40A0E9B4F7DU },
+    { 0x2A6498D1625BAC68U, 0x1E392010175EE596U }, { 0xEEB6E0A781E2F053U, 0x182DB34012B25144U },
+    { 0x58924D52CE4F26A9U, 0x1357C299A88EA76AU }, { 0x27507BB7B07EA441U, 0x1EF2D0F5DA7DD8AAU },
+    { 0x52A6C95FC0655034U, 0x18C240C4AECB13BBU }, { 0x0EEBD44C99EAA690U, 0x13CE9A36F23C0FC9U },
+    { 0xB17953ADC3110A80U, 0x1FB0F6BE50601941U }, { 0xC12DDC8B02740867U, 0x195A5EFEA6B34767U },
+    { 0x3424B06F3529A052U, 0x14484BFEEBC29F86U }, { 0x901D59F290EE19DBU, 0x1039D66589687F9EU },
+    { 0x4CFBC31DB4B0295FU, 0x19F623D5A8A73297U }, { 0x3D9635B15D59BAB2U, 0x14C4E977BA1F5BACU },
+    { 0x97AB5E277DE16228U, 0x109D8792FB4C4956U }, { 0xF2ABC9D8C9689D0DU, 0x1A95A5B7F87A0EF0U },
+    { 0x5BBCA17A3ABA173EU, 0x154484932D2E725AU }, { 0xAFCA1AC82EFB45CBU, 0x11039D428A8B8EAEU },
+    { 0xB2DCF7A6B1920945U, 0x1B38FB9DAA78E44AU }, { 0xF57D92EBC141A104U, 0x15C72FB1552D836EU },
+    { 0xC46475896767B403U, 0x116C262777579C58U }, { 0x6D6D88DBD8A5ECD2U, 0x1BE03D0BF225C6F4U },
+    { 0x8ABE071646EB23DBU, 0x164CFDA3281E38C3U }, { 0x6EFE6C11D255B649U, 0x11D7314F534B609CU },
+    { 0xB197134FB6EF8A0EU, 0x1C8B821885456760U }, { 0x27AC0F72F8BFA1A5U, 0x16D601AD376AB91AU },
+    { 0xB95672C260994E1EU, 0x1244CE242C5560E1U }, { 0xF5571E03CDC21695U, 0x1D3AE36D13BBCE35U },
+    { 0x2AAC18030B01ABABU, 0x17624F8A762FD82BU }, { 0xBBBCE0026F348956U, 0x12B50C6EC4F31355U },
+    { 0x92C7CCD0B1EDA889U, 0x1DEE7A4AD4B81EEFU }, { 0xDBD30A408E57BA07U, 0x17F1FB6F10934BF2U },
+    { 0x7CA8D50071DFC806U, 0x1327FC58DA0F6FF5U }, { 0xFAA7BB33E9660CD6U, 0x1EA6608E29B24CBBU },
+    { 0x9552FC298784D711U, 0x18851A0B548EA3C9U }, { 0xAAA8C9BAD2D0AC0EU, 0x139DAE6F76D88307U },
+    { 0xDDDADC5E1E1AACE3U, 0x1F62B0B257C0D1A5U }, { 0x7E48B04B4B488A4FU, 0x191BC08EAC9A4151U },
+    { 0xCB6D59D5D5D3A1D9U, 0x141633A556E1CDDAU }, { 0x3C577B1177DC817BU, 0x1011C2EAABE7D7E2U },
+    { 0xC6F25E825960CF2AU, 0x19B604AAACA62636U }, { 0x6BF518684780A5BBU, 0x14919D5556EB51C5U },
+    { 0x232A79ED06008496U, 0x10747DDDDF22A7D1U }, { 0xD1DD8FE1A3340756U, 0x1A53FC9631D10C81U },
+    { 0xA7E4731AE8F66C45U, 0x150FFD44F4A73D34U }, { 0x531D28E253F8569EU, 0x10D9976A5D52975DU },
+    { 0xEB61DB03B98D5762U, 0x1AF5BF109550F22EU }, { 0xBC4E48CFC7A445E8U, 0x159165A6DDDA5B58U },
+    { 0x6371D3D96C836B20U, 0x11411E1F17E1E2ADU }, { 0x9F1C8628AD9F11CDU, 0x1B9B6364F3030448U },
+    { 0xE5B06B53BE18DB0BU, 0x1615E91D8F359D06U }, { 0xEAF3890FCB4715A2U, 0x11AB20E472914A6BU },
+    { 0x44B8DB4C7871BC37U, 0x1C45016D841BAA46U }, { 0x03C715D6C6C1635FU, 0x169D9ABE03495505U },
+    { 0x3638DE456BCDE919U, 0x1217AEFE69077737U }, { 0x56C163A2461641C1U, 0x1CF2B1970E725858U },
+    { 0xDF011C81D1AB67CEU, 0x17288E1271F51379U }, { 0x7F3416CE4155ECA5U, 0x1286D80EC190DC61U },
+    { 0x6520247D3556476EU, 0x1DA48CE468E7C702U }, { 0xEA801D30F7783925U, 0x17B6D71D20B96C01U },
+    { 0xBB99B0F3F92CFA84U, 0x12F8AC174D612334U }, { 0x5F5C4E532847F739U, 0x1E5AACF215683854U },
+    { 0x7F7D0B75B9D32C2EU, 0x18488A5B44536043U }, { 0x9930D5F7C7DC2358U, 0x136D3B7C36A919CFU },
+    { 0x8EB4898C72F9D226U, 0x1F152BF9F10E8FB2U }, { 0x722A07A38F2E41B8U, 0x18DDBCC7F40BA628U },
+    { 0xC1BB394FA5BE9AFAU, 0x13E497065CD61E86U }, { 0x9C5EC2190930F7F6U, 0x1FD424D6FAF030D7U },
+    { 0x49E56814075A5FF8U, 0x197683DF2F268D79U }, { 0x6E51201005E1E660U, 0x145ECFE5BF520AC7U },
+    { 0xF1DA800CD181851AU, 0x104BD984990E6F05U }, { 0x4FC400148268D4F5U, 0x1A12F5A0F4E3E4D6U },
+    { 0xD96999AA01ED772BU, 0x14DBF7B3F71CB711U }, { 0xADEE1488018AC5BCU, 0x10AFF95CC5B09274U },
+    { 0x497CEDA668DE092CU, 0x1AB328946F80EA54U }, { 0x3ACA57B853E4D424U, 0x155C2076BF9A5510U },
+    { 0x623B7960431D7683U, 0x1116805EFFAEAA73U }, { 0x9D2BF566D1C8BD9EU, 0x1B5733CB32B110B8U },
+    { 0x7DBCC452416D647FU, 0x15DF5CA28EF40D60U }, { 0xCAFD69DB678AB6CCU, 0x117F7D4ED8C33DE6U },
+    { 0xAB2F0FC572778ADFU, 0x1BFF2EE48E052FD7U }, { 0x88F273045B92D580U, 0x1665BF1D3E6A8CACU },
+    { 0xD3F528D049424466U, 0x11EAFF4A98553D56U }, { 0xB988414D4203A0A3U, 0x1CAB3210F3BB9557U },
+    { 0x6139CDD76802E6E9U, 0x16EF5B40C2FC7779U }, { 0xE761717920025254U, 0x125915CD68C9F92DU },
+    { 0xA568B58E999D5086U, 0x1D5B561574765B7CU }, { 0x5120913EE14AA6D2U, 0x177C44DDF6C515FDU },
+    { 0xA74D40FF1AA21F0EU, 0x12C9D0B1923744CAU }, { 0x0BAECE64F769CB4AU, 0x1E0FB44F50586E11U },
+    { 0x3C8BD850C5EE3C3BU, 0x180C903F7379F1A7U }, { 0xCA0979DA37F1C9C9U, 0x133D4032C2C7F485U },
+    { 0xA9A8C2F6BFE942DBU, 0x1EC866B79E0CBA6FU }, { 0x2153CF2BCCBA9BE3U, 0x18A0522C7E709526U },
+    { 0x1AA9728970954982U, 0x13B374F06526DDB8U }, { 0xF775840F1A88759DU, 0x1F8587E7083E2F8CU },
+    { 0x5F9136727BA05E17U, 0x19379FEC0698260AU }, { 0x1940F85B9619E4DFU, 0x142C7FF0054684D5U },
+    { 0xE100C6AFAB47EA4CU, 0x1023998CD1053710U }, { 0xCE67A44C453FDD47U, 0x19D28F47B4D524E7U },
+    { 0xD852E9D69DCCB106U, 0x14A8729FC3DDB71FU }, { 0x79DBEE454B0A2738U, 0x1086C219697E2C19U },
+    { 0x295FE3A211A9D859U, 0x1A71368F0F30468FU }, { 0xBAB31C81A7BB137AU, 0x15275ED8D8F36BA5U },
+    { 0x6228E39AEC95A92FU, 0x10EC4BE0AD8F8951U }, { 0x9D0E38F7E0EF7517U, 0x1B13AC9AAF4C0EE8U },
+    { 0xB0D82D931A592A79U, 0x15A956E225D67253U }, { 0x8D79BE0F4847552EU, 0x11544581B7DEC1DCU },
+    { 0x158F967EDA0BBB7CU, 0x1BBA08CF8C979C94U }, { 0x77A611FF14D62F97U, 0x162E6D72D6DFB076U },
+    { 0xF951A7FF43DE8C79U, 0x11BEBDF578B2F391U }, { 0xC21C3FFED2FDAD8EU, 0x1C6463225AB7EC1CU },
+    { 0x01B0333242648AD8U, 0x16B6B5B5155FF017U }, { 0x0159C28E9B83A246U, 0x122BC490DDE659ACU },
+    { 0xCEF604175F3903A3U, 0x1D12D41AFCA3C2ACU }, { 0x725E69AC4C2D9C83U, 0x17424348CA1C9BBDU },
+    { 0xF5185489D68AE39CU, 0x129B69070816E2FDU }, { 0xEE8D540FBDAB05C6U, 0x1DC574D80CF16B2FU },
+    { 0xBED77672FE226B05U, 0x17D12A4670C1228CU }, { 0xFF12C528CB4EBC04U, 0x130DBB6B8D674ED6U },
+    { 0xCB513B74787DF9A0U, 0x1E7C5F127BD87E24U }, { 0x090DC929F9FE614DU, 0x18637F41FCAD31B7U },
+    { 0xA0D7D42194CB810AU, 0x1382CC34CA2427C5U }, { 0x67BFB9CF5478CE77U, 0x1F37AD21436D0C6FU },
+    { 0x1FCC94A5DD2D71F9U, 0x18F9574DCF8A7059U }, { 0x7FD6DD517DBDF4C7U, 0x13FAAC3E3FA1F37AU },
+    { 0xFFBE2EE8C92FEE0BU, 0x1FF779FD329CB8C3U }, { 0x6631BF20A0F324D6U, 0x1992C7FDC216FA36U },
+    { 0xB827CC1A1A5C1D78U, 0x14756CCB01ABFB5EU }, { 0x935309AE7B7CE460U, 0x105DF0A267BCC918U },
+    { 0x1EEB42B0C594A099U, 0x1A2FE76A3F9474F4U }, { 0xE58902270476E6E1U, 0x14F31F8832DD2A5CU },
+    { 0xB7A0CE859D2BEBE7U, 0x10C27FA028B0EEB0U }, { 0x59014A6F61DFDFD8U, 0x1AD0CC33744E4AB4U },
+    { 0xE0CDD525E7E64CADU, 0x1573D68F903EA229U }, { 0x4D7177518651D6F1U, 0x11297872D9CBB4EEU },
+    { 0x7BE8BEE8D6E957E8U, 0x1B758D848FAC54B0U }, { 0xFCBA3253DF211320U, 0x15F7A46A0C89DD59U },
+    { 0x63C8284318E74280U, 0x1192E9EE706E4AAEU }, { 0x060D0D3827D86A66U, 0x1C1E43171A4A1117U },
+    { 0x6B3DA42CECAD21EBU, 0x167E9C127B6E7412U }, { 0x88FE1CF0BD574E56U, 0x11FEE341FC585CDBU },
+    { 0x419694B462254A23U, 0x1CCB0536608D615FU }, { 0x67ABAA29E81DD4E9U, 0x1708D0F84D3DE77FU },
+    { 0xB95621BB2017DD87U, 0x126D73F9D764B932U }, { 0xC223692B668C95A5U, 0x1D7BECC2F23AC1EAU },
+    { 0xCE82BA891ED6DE1DU, 0x179657025B6234BBU }, { 0xA53562074BDF1818U, 0x12DEAC01E2B4F6FCU },
+    { 0x3B889CD87964F359U, 0x1E3113363787F194U }, { 0xFC6D4A46C783F5E1U, 0x18274291C6065ADCU },
+    { 0x30576E9F06032B1AU, 0x13529BA7D19EAF17U }, { 0x1A257DCB3CD1DE90U, 0x1EEA92A61C311825U },
+    { 0x481DFE3C30A7E540U, 0x18BBA884E35A79B7U }, { 0xD34B31C9C0865100U, 0x13C9539D82AEC7C5U },
+    { 0x5211E942CDA3B4CDU, 0x1FA885C8D117A609U }, { 0x74DB21023E1C90A4U, 0x19539E3A40DFB807U },
+    { 0xF715B401CB4A0D50U, 0x1442E4FB67196005U }, { 0xF8DE299B09080AA7U, 0x103583FC527AB337U },
+    { 0x8E304291A80CDDD7U, 0x19EF3993B72AB859U }, { 0x3E8D020E200A4B13U, 0x14BF6142F8EEF9E1U },
+    { 0x653D9B3E80083C0FU, 0x10991A9BFA58C7E7U }, { 0x6EC8F864000D2CE4U, 0x1A8E90F9908E0CA5U },
+    { 0x8BD3F9E999A423EAU, 0x153EDA614071A3B7U }, { 0x3CA994BAE1501CBBU, 0x10FF151A99F482F9U },
+    { 0xC775BAC49BB3612BU, 0x1B31BB5DC320D18EU }, { 0xD2C4956A16291A89U, 0x15C162B168E70E0BU },
+    { 0xDBD0778811BA7BA1U, 0x11678227871F3E6FU }, { 0x2C80BF401C5D929BU, 0x1BD8D03F3E9863E6U },
+    { 0xBD33CC3349E47549U, 0x16470CFF6546B651U }, { 0xCA8FD68F6E505DD4U, 0x11D270CC51055EA7U },
+    { 0x4419574BE3B3C953U, 0x1C83E7AD4E6EFDD9U }, { 0x0347790982F63AA9U, 0x16CFEC8AA52597E1U },
+    { 0xCF6C60D468C4FBBAU, 0x123FF06EEA847980U }, { 0xE57A34870E07F92AU, 0x1D331A4B10D3F59AU },
+    { 0x512E906C0B399422U, 0x175C1508DA432AE2U }, { 0xDA8BA6BCD5C7A9B5U, 0x12B010D3E1CF5581U },
+    { 0x90DF712E22D90F87U, 0x1DE6815302E5559CU }, { 0xDA4C5A8B4F140C6CU, 0x17EB9AA8CF1DDE16U },
+    { 0xAEA37BA2A5A9A38AU, 0x1322E220A5B17E78U }, { 0x7DD25F6AA2A905A9U, 0x1E9E369AA2B59727U },
+    { 0x97DB7F888220D154U, 0x187E92154EF7AC1FU }, { 0x797C6606CE80A777U, 0x139874DDD8C6234CU },
+    { 0x8F2D700AE4010BF1U, 0x1F5A549627A36BADU }, { 0x0C2459A25000D65AU, 0x191510781FB5EFBEU },
+    { 0x701D1481D99A4515U, 0x1410D9F9B2F7F2FEU }, { 0xC017439B147B6A77U, 0x100D7B2E28C65BFEU },
+    { 0xCCF205C4ED9243F2U, 0x19AF2B7D0E0A2CCAU }, { 0x0A5B37D0BE0E9CC2U, 0x148C22CA71A1BD6FU },
+    { 0x0848F973CB3EE3CEU, 0x10701BD527B4978CU }, { 0xDA0E5BEC78649FB0U, 0x1A4CF9550C5425ACU },
+    { 0x7B3EAFF060507FC0U, 0x150A6110D6A9B7BDU }, { 0x95CBBFF380406633U, 0x10D51A73DEEE2C97U },
+    { 0xEFAC665266CD7052U, 0x1AEE90B964B04758U }, { 0x2623850EB8A459DBU, 0x158BA6FAB6F36C47U },
+    { 0x1E82D0D893B6AE49U, 0x113C85955F29236CU }, { 0xFD9E1AF41F8AB075U, 0x1B9408EEFEA838ACU },
+    { 0x97B1AF29B2D559F7U, 0x16100725988693BDU }, { 0xAC8E25BAF5777B2CU, 0x11A66C1E139EDC97U },
+    { 0x7A7D092B2258C513U, 0x1C3D79C9B8FE2DBFU }, { 0x61FDA0EF4EAD6A76U, 0x169794A160CB57CCU },
+    { 0xE7FE1A590BBDEEC5U, 0x1212DD4DE7091309U }, { 0xA6635D5B45FCB13AU, 0x1CEAFBAFD80E84DCU },
+    { 0x851C4AAF6B308DC8U, 0x172262F3133ED0B0U }, { 0xD0E36EF2BC26D7D4U, 0x1281E8C275CBDA26U },
+    { 0xB49F17EAC6A48C86U, 0x1D9CA79D894629D7U }, { 0x2A18DFEF0550706BU, 0x17B08617A104EE46U },
+    { 0x54E0B3259DD9F389U, 0x12F39E794D9D8B6BU }, { 0x87CDEB6F62F65274U, 0x1E5297287C2F4578U },
+    { 0xD30B22BF825EA85DU, 0x18421286C9BF6AC6U }, { 0x0F3C1BCC684BB9E4U, 0x13680ED23AFF889FU },
+    { 0x18602C7A4079296DU, 0x1F0CE4839198DA98U }, { 0x46B356C833942124U, 0x18D71D360E13E213U },
+    { 0x388F78A029434DB6U, 0x13DF4A91A4DCB4DCU }, { 0x5A7F2766A86BAF8AU, 0x1FCBAA82A1612160U },
+    { 0x153285EBB9EFBFA2U, 0x196FBB9BB44DB44DU }, { 0xAA8ED189618C994EU, 0x145962E2F6A4903DU },
+    { 0xEED8A7A11AD6E10CU, 0x1047824F2BB6D9CAU }, { 0x7E27729B5E249B45U, 0x1A0C03B1DF8AF611U },
+    { 0xFE85F549181D4904U, 0x14D6695B193BF80DU }, { 0xCB9E5DD4134AA0D0U, 0x10AB877C142FF9A4U },
+    { 0xDF63C9535211014DU, 0x1AAC0BF9B9E65C3AU }, { 0x191CA10F74DA6771U, 0x15566FFAFB1EB02FU },
+    { 0xADB080D92A4852C1U, 0x1111F32F2F4BC025U }, { 0x15E7348EAA0D5134U, 0x1B4FEB7EB212CD09U },
+    { 0xAB1F5D3EEE710DC4U, 0x15D98932280F0A6DU }, { 0xBC1917658B8DA49DU, 0x117AD428200C0857U },
+    { 0x2CF4F23C127C3A94U, 0x1BF7B9D9CCE00D59U }, { 0xF0C3F4FCDB969543U, 0x165FC7E170B33DE0U },
+    { 0x5A365D9716121103U, 0x11E6398126F5CB1AU }, { 0x9056FC24F01CE804U, 0x1CA38F350B22DE90U },
+    { 0xD9DF301D8CE3ECD0U, 0x16E93F5DA2824BA6U }, { 0xE17F59B13D8323DAU, 0x125432B14ECEA2EBU },
+    { 0x68CBC2B52F38395CU, 0x1D53844EE47DD179U }, { 0x53D6355DBF602DE3U, 0x177603725064A794U },
+    { 0xA9782AB165E68B1CU, 0x12C4CF8EA6B6EC76U }, { 0x0F26AAB56FD744FAU, 0x1E07B27DD78B13F1U },
+    { 0x3F52222ABFDF6A62U, 0x18062864AC6F4327U }, { 0x65DB4E88997F884EU, 0x1338205089F29C1FU },
+    { 0x6FC54A7428CC0D4AU, 0x1EC033B40FEA9365U }, { 0x596AA1F68709A43BU, 0x1899C2F673220F84U },
+    { 0xADEEE7F86C07B696U, 0x13AE3591F5B4D936U }, { 0x497E3FF3E00C5756U, 0x1F7D228322BAF524U },
+    { 0xD464FFF64CD6AC45U, 0x1930E868E89590E9U }, { 0x4383FFF83D7889D1U, 0x14272053ED4473EEU },
+    { 0xCF9CCCC69793A174U, 0x101F4D0FF1038FF1U }, { 0x7F6147A425B90252U, 0x19CBAE7FE805B31CU },
+    { 0xCC4DD2E9B7C7350FU, 0x14A2F1FFECD15C16U }, { 0x3D0B0F215FD290D9U, 0x10825B3323DAB012U },
+    { 0x61AB4B689950E7C1U, 0x1A6A2B85062AB350U }, { 0x4E22A2BA1440B967U, 0x1521BC6A6B555C40U },
+    { 0x0B4EE894DD009453U, 0x10E7C9EEBC4449CDU }, { 0x1217DA87C800ED51U, 0x1B0C764AC6D3A948U },
+    { 0xDB46486CA000BDDAU, 0x15A391D56BDC876CU }, { 0x490506BD4CCD64AFU, 0x114FA7DDEFE39F8AU },
+    { 0xA8080AC87AE23AB1U, 0x1BB2A62FE638FF43U }, { 0x5339A239FBE82EF4U, 0x162884F31E93FF69U },
+    { 0x75C7B4FB2FECF25DU, 0x11BA03F5B20FFF87U }, { 0x22D92191E647EA2EU, 0x1C5CD322B67FFF3FU },
+    { 0xB57A8141850654F2U, 0x16B0A8E891FFFF65U }, { 0xC4620101373843F5U, 0x1226ED86DB3332B7U },
+    { 0x3A366801F1F39FEEU, 0x1D0B15A491EB8459U }, { 0xFB5EB99B27F6198BU, 0x173C115074BC69E0U },
+    { 0x2F7EFAE2865E7AD6U, 0x129674405D6387E7U }, { 0xE597F7D0D6FD9156U, 0x1DBD86CD6238D971U },
+    { 0x8479930D78CADAABU, 0x17CAD23DE82D7AC1U }, { 0xD06142712D6F1556U, 0x1308A831868AC89AU },
+    { 0x4D686A4EAF182222U, 0x1E74404F3DAADA91U }, { 0xA453883EF279B4E8U, 0x185D003F6488AEDAU },
+    { 0xE9DC6CFF28615D87U, 0x137D99CC506D58AEU }, { 0xA960AE650D6895A4U, 0x1F2F5C7A1A488DE4U },
+    { 0xBAB3BEB73DED4483U, 0x18F2B061AEA07183U }, { 0x2EF6322C318A9D36U, 0x13F559E7BEE6C136U },
+    { 0xE4BD1D13827761F0U, 0x1FEEF63F97D79B89U }, { 0x83CA7DA9352C4E5AU, 0x198BF832DFDFAFA1U },
+    { 0x9CA1FE20F756A515U, 0x146FF9C24CB2F2E7U }, { 0x4A1B31B3F9121DAAU, 0x1059949B708F28B9U },
+    { 0x435EB5ECC1B695DDU, 0x1A28EDC580E50DF5U }, { 0x35E55E57015EDE4AU, 0x14ED8B04671DA4C4U },
+    { 0xC4B77EAC0118B1D5U, 0x10BE08D0527E1D69U }, { 0xA12597799B5AB622U, 0x1AC9A7B3B7302F0FU },
+    { 0x4DB7AC6149155E81U, 0x156E1FC2F8F358D9U }, { 0xD7C6238107444B9BU, 0x1124E63593F5E0ADU },
+    { 0x593D059B3ED3AC2BU, 0x1B6E3D2286563449U }, { 0xE0FD9E15CBDC89BCU, 0x15F1CA820511C36DU },
+    { 0xB3FE18116FE3A163U, 0x118E3B9B37416924U }, { 0x866359B57FD29BD1U, 0x1C16C5C525357507U },
+    { 0xD1E91491330EE30EU, 0x16789E3750F790D2U }, { 0x74BA76DA8F3F1C0BU, 0x11FA182C40C60D75U },
+    { 0xEDF72490E531C678U, 0x1CC359E067A348BBU }, { 0x8B2C1D40B75B052DU, 0x1702AE4D1FB5D3C9U },
+    { 0x6F567DCD5F7C0424U, 0x12688B70E62B0FD4U }, { 0x7EF0C94898C66D06U, 0x1D74124E3D11B2EDU },
+    { 0x98C0A106E09EBD9FU, 0x17900EA4FDA7C257U }, { 0x470080D24D4BCAE6U, 0x12D9A550CAEC9B79U },
+    { 0xD800CE1D487944A2U, 0x1E29088144ADC58EU }, { 0x1333D8176D2DD082U, 0x1820D39A9D57D13FU },
+    { 0xA8F646792424A6CEU, 0x134D76154AACA765U }, { 0x74BD3D8EA03AA47DU, 0x1EE25688777AA56FU },
+    { 0x5D64313EE6955064U, 0x18B51206C5FBB78CU }, { 0x4AB68DCBEBAAA6B7U, 0x13C40E6BD1962C70U },
+    { 0x1124161312AAA457U, 0x1FA01712E8F0471AU }, { 0xDA8344DC0EEEE9DFU, 0x194CDF4253F36C14U },
+    { 0xE2029D7CD8BF2180U, 0x143D7F6843292343U }, { 0x4E687DFD7A328133U, 0x103132B9CF541C36U },
+    { 0x4A40C9959050CEB8U, 0x19E851294BB9C6BDU }, { 0x0833D477A6A70BC6U, 0x14B9DA876FC7D231U },
+    { 0xA02976C61EEC096BU, 0x1094AED2BFD30E8DU }, { 0x004257A364ACDBDFU, 0x1A877E1DFFB81749U },
+    { 0xCD01DFB5EA23E319U, 0x153931B1996012A0U }, { 0x70CE4C91881CB5AEU, 0x10FA8E27ADE6754DU },
+    { 0x1AE3ADB5A69455E2U, 0x1B2A7D0C4970BBAFU }, { 0x7BE957C4854377E8U, 0x15BB973D078D62F2U },
+    { 0xC987796A0435F987U, 0x1162DF64060AB58EU }, { 0x75A58F1006BCC271U, 0x1BD1656CD67788E4U },
+    { 0xF7B7A5A66BCA3527U, 0x16411DF0AB92D3E9U }, { 0x5FC61E1EBCA1C41FU, 0x11CDB18D560F0FEEU },
+    { 0xFFA363646102D365U, 0x1C7C4F4889B1B316U }, { 0x32E91C504D9BDC51U, 0x16C9D906D48E28DFU },
+    { 0x8F20E37371497D0EU, 0x123B140576D820B2U }, { 0x7E9B0585820F2E7CU, 0x1D2B533BF159CDEAU },
+    { 0xCBAF379E01A5BECAU, 0x1755DC2FF447D7EEU }, { 0x0958F94B348498A1U, 0x12AB168CC36CACBFU }
+};
+
+constexpr uint64_t ryu_pow5_split_lut[][2]
+{
+    { 0x0000000000000000U, 0x1000000000000000U }, { 0x0000000000000000U, 0x1400000000000000U },
+    { 0x0000000000000000U, 0x1900000000000000U }, { 0x0000000000000000U, 0x1F40000000000000U },
+    { 0x0000000000000000U, 0x1388000000000000U }, { 0x0000000000000000U, 0x186A000000000000U },
+    { 0x0000000000000000U, 0x1E84800000000000U }, { 0x0000000000000000U, 0x1312D00000000000U },
+    { 0x0000000000000000U, 0x17D7840000000000U }, { 0x0000000000000000U, 0x1DCD650000000000U },
+    { 0x0000000000000000U, 0x12A05F2000000000U }, { 0x0000000000000000U, 0x174876E800000000U },
+    { 0x0000000000000000U, 0x1D1A94A200000000U }, { 0x0000000000000000U, 0x12309CE540000000U },
+    { 0x0000000000000000U, 0x16BCC41E90000000U }, { 0x0000000000000000U, 0x1C6BF52634000000U },
+    { 0x0000000000000000U, 0x11C37937E0800000U }, { 0x0000000000000000U, 0x16345785D8A00000U },
+    { 0x0000000000000000U, 0x1BC16D674EC80000U }, { 0x0000000000000000U, 0x1158E460913D0000U },
+    { 0x0000000000000000U, 0x15AF1D78B58C4000U }, { 0x0000000000000000U, 0x1B1AE4D6E2EF5000U },
+    { 0x0000000000000000U, 0x10F0CF064DD59200U }, { 0x0000000000000000U, 0x152D02C7E14AF680U },
+    { 0x0000000000000000U, 0x1A784379D99DB420U }, { 0x0000000000000000U, 0x108B2A2C28029094U },
+    { 0x0000000000000000U, 0x14ADF4B7320334B9U }, { 0x4000000000000000U, 0x19D971E4FE8401E7U },
+    { 0x8800000000000000U, 0x1027E72F1F128130U }, { 0xAA00000000000000U, 0x1431E0FAE6D7217CU },
+    { 0xD480000000000000U, 0x193E5939A08CE9DBU }, { 0xC9A0000000000000U, 0x1F8DEF8808B02452U },
+    { 0xBE04000000000000U, 0x13B8B5B5056E16B3U }, { 0xAD85000000000000U, 0x18A6E32246C99C60U },
+    { 0xD8E6400000000000U, 0x1ED09BEAD87C0378U }, { 0x878FE80000000000U, 0x13426172C74D822BU },
+    { 0x6973E20000000000U, 0x1812F9CF7920E2B6U }, { 0x03D0DA8000000000U, 0x1E17B84357691B64U },
+    { 0x8262889000000000U, 0x12CED32A16A1B11EU }, { 0x22FB2AB400000000U, 0x178287F49C4A1D66U },
+    { 0xABB9F56100000000U, 0x1D6329F1C35CA4BFU }, { 0xCB54395CA0000000U, 0x125DFA371A19E6F7U },
+    { 0xBE2947B3C8000000U, 0x16F578C4E0A060B5U }, { 0x2DB399A0BA000000U, 0x1CB2D6F618C878E3U },
+    { 0xFC90400474400000U, 0x11EFC659CF7D4B8DU }, { 0x7BB4500591500000U, 0x166BB7F0435C9E71U },
+    { 0xDAA16406F5A40000U, 0x1C06A5EC5433C60DU }, { 0xA8A4DE8459868000U, 0x118427B3B4A05BC8U },
+    { 0xD2CE16256FE82000U, 0x15E531A0A1C872BAU }, { 0x87819BAECBE22800U, 0x1B5E7E08CA3A8F69U },
+    { 0xF4B1014D3F6D5900U, 0x111B0EC57E6499A1U }, { 0x71DD41A08F48AF40U, 0x1561D276DDFDC00AU },
+    { 0x0E549208B31ADB10U, 0x1ABA4714957D300DU }, { 0x28F4DB456FF0C8EAU, 0x10B46C6CDD6E3E08U },
+    { 0x33321216CBECFB24U, 0x14E1878814C9CD8AU }, { 0xBFFE969C7EE839EDU, 0x1A19E96A19FC40ECU },
+    { 0xF7FF1E21CF512434U, 0x105031E2503DA893U }, { 0xF5FEE5AA43256D41U, 0x14643E5AE44D12B8U },
+    { 0x337E9F14D3EEC892U, 0x197D4DF19D605767U }, { 0x005E46DA08EA7AB6U, 0x1FDCA16E04B86D41U },
+    { 0xA03AEC4845928CB2U, 0x13E9E4E4C2F34448U }, { 0xC849A75A56F72FDEU, 0x18E45E1DF3B0155AU },
+    { 0x7A5C1130ECB4FBD6U, 0x1F1D75A5709C1AB1U }, { 0xEC798ABE93F11D65U, 0x13726987666190AEU },
+    { 0xA797ED6E38ED64BFU, 0x184F03E93FF9F4DAU }, { 0x517DE8C9C728BDEFU, 0x1E62C4E38FF87211U },
+    { 0xD2EEB17E1C7976B5U, 0x12FDBB0E39FB474AU }, { 0x87AA5DDDA397D462U, 0x17BD29D1C87A191DU },
+    { 0xE994F5550C7DC97BU, 0x1DAC74463A989F64U }, { 0x11FD195527CE9DEDU, 0x128BC8ABE49F639FU },
+    { 0xD67C5FAA71C24568U, 0x172EBAD6DDC73C86U }, { 0x8C1B77950E32D6C2U, 0x1CFA698C95390BA8U },
+    { 0x57912ABD28DFC639U, 0x121C81F7DD43A749U }, { 0xAD75756C7317B7C8U, 0x16A3A275D494911BU },
+    { 0x98D2D2C78FDDA5BAU, 0x1C4C8B1349B9B562U }, { 0x9F83C3BCB9EA8794U, 0x11AFD6EC0E14115DU },
+    { 0x0764B4ABE8652979U, 0x161BCCA7119915B5U }, { 0x493DE1D6E27E73D7U, 0x1BA2BFD0D5FF5B22U },
+    { 0x6DC6AD264D8F0866U, 0x1145B7E285BF98F5U }, { 0xC938586FE0F2CA80U, 0x159725DB272F7F32U },
+    { 0x7B866E8BD92F7D20U, 0x1AFCEF51F0FB5EFFU }, { 0xAD34051767BDAE34U, 0x10DE1593369D1B5FU },
+    { 0x9881065D41AD19C1U, 0x15159AF804446237U }, { 0x7EA147F492186032U, 0x1A5B01B605557AC5U },
+    { 0x6F24CCF8DB4F3C1FU, 0x1078E111C3556CBBU }, { 0x4AEE003712230B27U, 0x14971956342AC7EAU },
+    { 0xDDA98044D6ABCDF0U, 0x19BCDFABC13579E4U }, { 0x0A89F02B062B60B6U, 0x10160BCB58C16C2FU },
+    { 0xCD2C6C35C7B638E4U, 0x141B8EBE2EF1C73AU }, { 0x8077874339A3C71DU, 0x1922726DBAAE3909U },
+    { 0xE0956914080CB8E4U, 0x1F6B0F092959C74BU }, { 0x6C5D61AC8507F38EU, 0x13A2E965B9D81C8FU },
+    { 0x4774BA17A649F072U, 0x188BA3BF284E23B3U }, { 0x1951E89D8FDC6C8FU, 0x1EAE8CAEF261ACA0U },
+    { 0x0FD3316279E9C3D9U, 0x132D17ED577D0BE4U }, { 0x13C7FDBB186434CFU, 0x17F85DE8AD5C4EDDU },
+    { 0x58B9FD29DE7D4203U, 0x1DF67562D8B36294U }, { 0xB7743E3A2B0E4942U, 0x12BA095DC7701D9CU },
+    { 0xE5514DC8B5D1DB92U, 0x17688BB5394C2503U }, { 0xDEA5A13AE3465277U, 0x1D42AEA2879F2E44U },
+    { 0x0B2784C4CE0BF38AU, 0x1249AD2594C37CEBU }, { 0xCDF165F6018EF06DU, 0x16DC186EF9F45C25U },
+    { 0x416DBF7381F2AC88U, 0x1C931E8AB871732FU }, { 0x88E497A83137ABD5U, 0x11DBF316B346E7FDU },
+    { 0xEB1DBD923D8596CAU, 0x1652EFDC6018A1FCU }, { 0x25E52CF6CCE6FC7DU, 0x1BE7ABD3781ECA7CU },
+    { 0x97AF3C1A40105DCEU, 0x1170CB642B133E8DU }, { 0xFD9B0B20D0147542U, 0x15CCFE3D35D80E30U },
+    { 0x3D01CDE904199292U, 0x1B403DCC834E11BDU }, { 0x462120B1A28FFB9BU, 0x1108269FD210CB16U },
+    { 0xD7A968DE0B33FA82U, 0x154A3047C694FDDBU }, { 0xCD93C3158E00F923U, 0x1A9CBC59B83A3D52U },
+    { 0xC07C59ED78C09BB6U, 0x10A1F5B813246653U }, { 0xB09B7068D6F0C2A3U, 0x14CA732617ED7FE8U },
+    { 0xDCC24C830CACF34CU, 0x19FD0FEF9DE8DFE2U }, { 0xC9F96FD1E7EC180FU, 0x103E29F5C2B18BEDU },
+    { 0x3C77CBC661E71E13U, 0x144DB473335DEEE9U }, { 0x8B95BEB7FA60E598U, 0x1961219000356AA3U },
+    { 0x6E7B2E65F8F91EFEU, 0x1FB969F40042C54CU }, { 0xC50CFCFFBB9BB35FU, 0x13D3E2388029BB4FU },
+    { 0xB6503C3FAA82A037U, 0x18C8DAC6A0342A23U }, { 0xA3E44B4F95234844U, 0x1EFB1178484134ACU },
+    { 0xE66EAF11BD360D2BU, 0x135CEAEB2D28C0EBU }, { 0xE00A5AD62C839075U, 0x183425A5F872F126U },
+    { 0x980CF18BB7A47493U, 0x1E412F0F768FAD70U }, { 0x5F0816F752C6C8DCU, 0x12E8BD69AA19CC66U },
+    { 0xF6CA1CB527787B13U, 0x17A2ECC414A03F7FU }, { 0xF47CA3E2715699D7U, 0x1D8BA7F519C84F5FU },
+    { 0xF8CDE66D86D62026U, 0x127748F9301D319BU }, { 0xF7016008E88BA830U, 0x17151B377C247E02U },
+    { 0xB4C1B80B22AE923CU, 0x1CDA62055B2D9D83U }, { 0x50F91306F5AD1B65U, 0x12087D4358FC8272U },
+    { 0xE53757C8B318623FU, 0x168A9C942F3BA30EU }, { 0x9E852DBADFDE7ACFU, 0x1C2D43B93B0A8BD2U },
+    { 0xA3133C94CBEB0CC1U, 0x119C4A53C4E69763U }, { 0x8BD80BB9FEE5CFF1U, 0x16035CE8B6203D3CU },
+    { 0xAECE0EA87E9F43EEU, 0x1B843422E3A84C8BU }, { 0x4D40C9294F238A75U, 0x1132A095CE492FD7U },
+    { 0x2090FB73A2EC6D12U, 0x157F48BB41DB7BCDU }, { 0x68B53A508BA78856U, 0x1ADF1AEA12525AC0U },
+    { 0x417144725748B536U, 0x10CB70D24B7378B8U }, { 0x51CD958EED1AE283U, 0x14FE4D06DE5056E6U },
+    { 0xE640FAF2A8619B24U, 0x1A3DE04895E46C9FU }, { 0xEFE89CD7A93D00F7U, 0x1066AC2D5DAEC3E3U },
+    { 0xEBE2C40D938C4134U, 0x14805738B51A74DCU }, { 0x26DB7510F86F5181U, 0x19A06D06E2611214U },
+    { 0x9849292A9B4592F1U, 0x100444244D7CAB4CU }, { 0xBE5B73754216F7ADU, 0x1405552D60DBD61FU },
+    { 0xADF25052929CB598U, 0x1906AA78B912CBA7U }, { 0x996EE4673743E2FFU, 0x1F485516E7577E91U },
+    { 0xFFE54EC0828A6DDFU, 0x138D352E5096AF1AU }, { 0xBFDEA270A32D0957U, 0x18708279E4BC5AE1U },
+    { 0x2FD64B0CCBF84BADU, 0x1E8CA3185DEB719AU }, { 0x5DE5EEE7FF7B2F4CU, 0x1317E5EF3AB32700U },
+    { 0x755F6AA1FF59FB1FU, 0x17DDDF6B095FF0C0U }, { 0x92B7454A7F3079E7U, 0x1DD55745CBB7ECF0U },
+    { 0x5BB28B4E8F7E4C30U, 0x12A5568B9F52F416U }, { 0xF29F2E22335DDF3CU, 0x174EAC2E8727B11BU },
+    { 0xEF46F9AAC035570BU, 0x1D22573A28F19D62U }, { 0xD58C5C0AB8215667U, 0x123576845997025DU },
+    { 0x4AEF730D6629AC01U, 0x16C2D4256FFCC2F5U }, { 0x9DAB4FD0BFB41701U, 0x1C73892ECBFBF3B2U },
+    { 0xA28B11E277D08E60U, 0x11C835BD3F7D784FU }, { 0x8B2DD65B15C4B1F9U, 0x163A432C8F5CD663U },
+    { 0x6DF94BF1DB35DE77U, 0x1BC8D3F7B3340BFCU }, { 0xC4BBCF772901AB0AU, 0x115D847AD000877DU },
+    { 0x35EAC354F34215CDU, 0x15B4E5998400A95DU }, { 0x8365742A30129B40U, 0x1B221EFFE500D3B4U },
+    { 0xD21F689A5E0BA108U, 0x10F5535FEF208450U }, { 0x06A742C0F58E894AU, 0x1532A837EAE8A565U },
+    { 0x4851137132F22B9DU, 0x1A7F5245E5A2CEBEU }, { 0xED32AC26BFD75B42U, 0x108F936BAF85C136U },
+    { 0xA87F57306FCD3212U, 0x14B378469B673184U }, { 0xD29F2CFC8BC07E97U, 0x19E056584240FDE5U },
+    { 0xA3A37C1DD7584F1EU, 0x102C35F729689EAFU }, { 0x8C8C5B254D2E62E6U, 0x14374374F3C2C65BU },
+    { 0x6FAF71EEA079FB9FU, 0x1945145230B377F2U }, { 0x0B9B4E6A48987A87U, 0x1F965966BCE055EFU },
+    { 0x674111026D5F4C94U, 0x13BDF7E0360C35B5U }, { 0xC111554308B71FBAU, 0x18AD75D8438F4322U },
+    { 0x7155AA93CAE4E7A8U, 0x1ED8D34E547313EBU }, { 0x26D58A9C5ECF10C9U, 0x13478410F4C7EC73U },
+    { 0xF08AED437682D4FBU, 0x1819651531F9E78FU }, { 0xECADA89454238A3AU, 0x1E1FBE5A7E786173U },
+    { 0x73EC895CB4963664U, 0x12D3D6F88F0B3CE8U }, { 0x90E7ABB3E1BBC3FDU, 0x1788CCB6B2CE0C22U },
+    { 0x352196A0DA2AB4FDU, 0x1D6AFFE45F818F2BU }, { 0x0134FE24885AB11EU, 0x1262DFEEBBB0F97BU },
+    { 0xC1823DADAA715D65U, 0x16FB97EA6A9D37D9U }, { 0x31E2CD19150DB4BFU, 0x1CBA7DE5054485D0U },
+    { 0x1F2DC02FAD2890F7U, 0x11F48EAF234AD3A2U }, { 0xA6F9303B9872B535U, 0x1671B25AEC1D888AU },
+    { 0x50B77C4A7E8F6282U, 0x1C0E1EF1A724EAADU }, { 0x5272ADAE8F199D91U, 0x1188D357087712ACU },
+    { 0x670F591A32E004F6U, 0x15EB082CCA94D757U }, { 0x40D32F60BF980633U, 0x1B65CA37FD3A0D2DU },
+    { 0x4883FD9C77BF03E0U, 0x111F9E62FE44483CU }, { 0x5AA4FD0395AEC4D8U, 0x156785FBBDD55A4BU },
+    { 0x314E3C447B1A760EU, 0x1AC1677AAD4AB0DEU }, { 0xDED0E5AACCF089C9U, 0x10B8E0ACAC4EAE8AU },
+    { 0x96851F15802CAC3BU, 0x14E718D7D7625A2DU }, { 0xFC2666DAE037D74AU, 0x1A20DF0DCD3AF0B8U },
+    { 0x9D980048CC22E68EU, 0x10548B68A044D673U }, { 0x84FE005AFF2BA032U, 0x1469AE42C8560C10U },
+    { 0xA63D8071BEF6883EU, 0x198419D37A6B8F14U }, { 0xCFCCE08E2EB42A4EU, 0x1FE52048590672D9U },
+    { 0x21E00C58DD309A70U, 0x13EF342D37A407C8U }, { 0x2A580F6F147CC10DU, 0x18EB0138858D09BAU },
+    { 0xB4EE134AD99BF150U, 0x1F25C186A6F04C28U }, { 0x7114CC0EC80176D2U, 0x137798F428562F99U },
+    { 0xCD59FF127A01D486U, 0x18557F31326BBB7FU }, { 0xC0B07ED7188249A8U, 0x1E6ADEFD7F06AA5FU },
+    { 0xD86E4F466F516E09U, 0x1302CB5E6F642A7BU }, { 0xCE89E3180B25C98BU, 0x17C37E360B3D351AU },
+    { 0x822C5BDE0DEF3BEEU, 0x1DB45DC38E0C8261U }, { 0xF15BB96AC8B58575U, 0x1290BA9A38C7D17CU },
+    { 0x2DB2A7C57AE2E6D2U, 0x1734E940C6F9C5DCU }, { 0x391F51B6D99BA086U, 0x1D022390F8B83753U },
+    { 0x03B3931248014454U, 0x1221563A9B732294U }, { 0x04A077D6DA019569U, 0x16A9ABC9424FEB39U },
+    { 0x45C895CC9081FAC3U, 0x1C5416BB92E3E607U }, { 0x8B9D5D9FDA513CBAU, 0x11B48E353BCE6FC4U },
+    { 0xAE84B507D0E58BE8U, 0x1621B1C28AC20BB5U }, { 0x1A25E249C51EEEE3U, 0x1BAA1E332D728EA3U },
+    { 0xF057AD6E1B33554DU, 0x114A52DFFC679925U }, { 0x6C6D98C9A2002AA1U, 0x159CE797FB817F6FU },
+    { 0x4788FEFC0A803549U, 0x1B04217DFA61DF4BU }, { 0x0CB59F5D8690214EU, 0x10E294EEBC7D2B8FU },
+    { 0xCFE30734E83429A1U, 0x151B3A2A6B9C7672U }, { 0x83DBC9022241340AU, 0x1A6208B50683940FU },
+    { 0xB2695DA15568C086U, 0x107D457124123C89U }, { 0x1F03B509AAC2F0A7U, 0x149C96CD6D16CBACU },
+    { 0x26C4A24C1573ACD1U, 0x19C3BC80C85C7E97U }, { 0x783AE56F8D684C03U, 0x101A55D07D39CF1EU },
+    { 0x16499ECB70C25F03U, 0x1420EB449C8842E6U }, { 0x9BDC067E4CF2F6C4U, 0x19292615C3AA539FU },
+    { 0x82D3081DE02FB476U, 0x1F736F9B3494E887U }, { 0xB1C3E512AC1DD0C9U, 0x13A825C100DD1154U },
+    { 0xDE34DE57572544FCU, 0x18922F31411455A9U }, { 0x55C215ED2CEE963BU, 0x1EB6BAFD91596B14U },
+    { 0xB5994DB43C151DE5U, 0x133234DE7AD7E2ECU }, { 0xE2FFA1214B1A655EU, 0x17FEC216198DDBA7U },
+    { 0xDBBF89699DE0FEB6U, 0x1DFE729B9FF15291U }, { 0x2957B5E202AC9F31U, 0x12BF07A143F6D39BU },
+    { 0xF3ADA35A8357C6FEU, 0x176EC98994F48881U }, { 0x70990C31242DB8BDU, 0x1D4A7BEBFA31AAA2U },
+    { 0x865FA79EB69C9376U, 0x124E8D737C5F0AA5U }, { 0xE7F791866443B854U, 0x16E230D05B76CD4EU },
+    { 0xA1F575E7FD54A669U, 0x1C9ABD04725480A2U }, { 0xA53969B0FE54E801U, 0x11E0B622C774D065U },
+    { 0x0E87C41D3DEA2202U, 0x1658E3AB7952047FU }, { 0xD229B5248D64AA82U, 0x1BEF1C9657A6859EU },
+    { 0x435A1136D85EEA91U, 0x117571DDF6C81383U }, { 0x143095848E76A536U, 0x15D2CE55747A1864U },
+    { 0x193CBAE5B2144E83U, 0x1B4781EAD1989E7DU }, { 0x2FC5F4CF8F4CB112U, 0x110CB132C2FF630EU },
+    { 0xBBB77203731FDD56U, 0x154FDD7F73BF3BD1U }, { 0x2AA54E844FE7D4ACU, 0x1AA3D4DF50AF0AC6U },
+    { 0xDAA75112B1F0E4EBU, 0x10A6650B926D66BBU }, { 0xD15125575E6D1E26U, 0x14CFFE4E7708C06AU },
+    { 0x85A56EAD360865B0U, 0x1A03FDE214CAF085U }, { 0x7387652C41C53F8EU, 0x10427EAD4CFED653U },
+    { 0x50693E7752368F71U, 0x14531E58A03E8BE8U }, { 0x64838E1526C4334EU, 0x1967E5EEC84E2EE2U },
+    { 0xFDA4719A70754022U, 0x1FC1DF6A7A61BA9AU }, { 0xDE86C70086494815U, 0x13D92BA28C7D14A0U },
+    { 0x162878C0A7DB9A1AU, 0x18CF768B2F9C59C9U }, { 0x5BB296F0D1D280A1U, 0x1F03542DFB83703BU },
+    { 0x194F9E5683239064U, 0x1362149CBD322625U }, { 0x5FA385EC23EC747EU, 0x183A99C3EC7EAFAEU },
+    { 0xF78C67672CE7919DU, 0x1E494034E79E5B99U }, { 0x3AB7C0A07C10BB02U, 0x12EDC82110C2F940U },
+    { 0x4965B0C89B14E9C3U, 0x17A93A2954F3B790U }, { 0x5BBF1CFAC1DA2433U, 0x1D9388B3AA30A574U },
+    { 0xB957721CB92856A0U, 0x127C35704A5E6768U }, { 0xE7AD4EA3E7726C48U, 0x171B42CC5CF60142U },
+    { 0xA198A24CE14F075AU, 0x1CE2137F74338193U }, { 0x44FF65700CD16498U, 0x120D4C2FA8A030FCU },
+    { 0x563F3ECC1005BDBEU, 0x16909F3B92C83D3BU }, { 0x2BCF0E7F14072D2EU, 0x1C34C70A777A4C8AU },
+    { 0x5B61690F6C847C3DU, 0x11A0FC668AAC6FD6U }, { 0xF239C35347A59B4CU, 0x16093B802D578BCBU },
+    { 0xEEC83428198F021FU, 0x1B8B8A6038AD6EBEU }, { 0x553D20990FF96153U, 0x1137367C236C6537U },
+    { 0x2A8C68BF53F7B9A8U, 0x1585041B2C477E85U }, { 0x752F82EF28F5A812U, 0x1AE64521F7595E26U },
+    { 0x093DB1D57999890BU, 0x10CFEB353A97DAD8U }, { 0x0B8D1E4AD7FFEB4EU, 0x1503E602893DD18EU },
+    { 0x8E7065DD8DFFE622U, 0x1A44DF832B8D45F1U }, { 0xF9063FAA78BFEFD5U, 0x106B0BB1FB384BB6U },
+    { 0xB747CF9516EFEBCAU, 0x1485CE9E7A065EA4U }, { 0xE519C37A5CABE6BDU, 0x19A742461887F64DU },
+    { 0xAF301A2C79EB7036U, 0x1008896BCF54F9F0U }, { 0xDAFC20B798664C43U, 0x140AABC6C32A386CU },
+    { 0x11BB28E57E7FDF54U, 0x190D56B873F4C688U }, { 0x1629F31EDE1FD72AU, 0x1F50AC6690F1F82AU },
+    { 0x4DDA37F34AD3E67AU, 0x13926BC01A973B1AU }, { 0xE150C5F01D88E019U, 0x187706B0213D09E0U },
+    { 0x19A4F76C24EB181FU, 0x1E94C85C298C4C59U }, { 0xB0071AA39712EF13U, 0x131CFD3999F7AFB7U },
+    { 0x9C08E14C7CD7AAD8U, 0x17E43C8800759BA5U }, { 0x030B199F9C0D958EU, 0x1DDD4BAA0093028FU },
+    { 0x61E6F003C1887D79U, 0x12AA4F4A405BE199U }, { 0xBA60AC04B1EA9CD7U, 0x1754E31CD072D9FFU },
+    { 0xA8F8D705DE65440DU, 0x1D2A1BE4048F907FU }, { 0xC99B8663AAFF4A88U, 0x123A516E82D9BA4FU },
+    { 0xBC0267FC95BF1D2AU, 0x16C8E5CA239028E3U }, { 0xAB0301FBBB2EE474U, 0x1C7B1F3CAC74331CU },
+    { 0xEAE1E13D54FD4EC9U, 0x11CCF385EBC89FF1U }, { 0x659A598CAA3CA27BU, 0x1640306766BAC7EEU },
+    { 0xFF00EFEFD4CBCB1AU, 0x1BD03C81406979E9U }, { 0x3F6095F5E4FF5EF0U, 0x116225D0C841EC32U },
+    { 0xCF38BB735E3F36ACU, 0x15BAAF44FA52673EU }, { 0x8306EA5035CF0457U, 0x1B295B1638E7010EU },
+    { 0x11E4527221A162B6U, 0x10F9D8EDE39060A9U }, { 0x565D670EAA09BB64U, 0x15384F295C7478D3U },
+    { 0x2BF4C0D2548C2A3DU, 0x1A8662F3B3919708U }, { 0x1B78F88374D79A66U, 0x1093FDD8503AFE65U },
+    { 0x625736A4520D8100U, 0x14B8FD4E6449BDFEU }, { 0xFAED044D6690E140U, 0x19E73CA1FD5C2D7DU },
+    { 0xBCD422B0601A8CC8U, 0x103085E53E599C6EU }, { 0x6C092B5C78212FFAU, 0x143CA75E8DF0038AU },
+    { 0x070B763396297BF8U, 0x194BD136316C046DU }, { 0x48CE53C07BB3DAF6U, 0x1F9EC583BDC70588U },
+    { 0x2D80F4584D5068DAU, 0x13C33B72569C6375U }, { 0x78E1316E60A48310U, 0x18B40A4EEC437C52U },
+    { 0x17197DC9F8CDA3D4U, 0x1EE10CE2A7545B67U }, { 0x6E6FEE9E3B808665U, 0x134CA80DA894B920U },
+    { 0x8A0BEA45CA60A7FEU, 0x181FD21112B9E768U }, { 0xAC8EE4D73CF8D1FDU, 0x1E27C69557686142U },
+    { 0xABD94F06861B833EU, 0x12D8DC1D56A13CC9U }, { 0x16CFA2C827A2640EU, 0x178F1324AC498BFCU },
+    { 0x1C838B7A318AFD11U, 0x1D72D7EDD75BEEFBU }, { 0xF1D2372C5EF6DE2BU, 0x1267C6F4A699755CU },
+    { 0x2E46C4F776B495B6U, 0x1701B8B1D03FD2B4U }, { 0x39D876355461BB23U, 0x1CC226DE444FC761U },
+    { 0xC42749E154BD14F6U, 0x11F9584AEAB1DC9CU }, { 0xF5311C59A9EC5A33U, 0x1677AE5DA55E53C3U },
+    { 0xF27D6370146770C0U, 0x1C1599F50EB5E8B4U }, { 0x178E5E260CC0A678U, 0x118D80392931B171U },
+    { 0x5D71F5AF8FF0D016U, 0x15F0E047737E1DCDU }, { 0xB4CE731B73ED041CU, 0x1B6D1859505DA540U }
+};
+
+#elif defined(USF_FLOAT_ENGINE_COMPACT)
+// Ryu small lookup tables: the 5^-i and 5^i entries (same format as the full
+// tables above, up to the same indexes) are computed from every 26th one and
+// 5^0..5^25, then corrected by 2 bit offsets (16 per word) for the truncation
+// errors of the multiplication. See ryu/d2s_small_table.h.
+constexpr uint64_t ryu_pow5_inv_split_base_lut[][2]
+{
+    { 0x0000000000000001U, 0x2000000000000000U }, { 0x52A6C95FC0655034U, 0x18C240C4AECB13BBU },
+    { 0x7CA8D50071DFC806U, 0x1327FC58DA0F6FF5U }, { 0x6520247D3556476EU, 0x1DA48CE468E7C702U },
+    { 0x6139CDD76802E6E9U, 0x16EF5B40C2FC7779U }, { 0xF951A7FF43DE8C79U, 0x11BEBDF578B2F391U },
+    { 0x7BE8BEE8D6E957E8U, 0x1B758D848FAC54B0U }, { 0x8BD3F9E999A423EAU, 0x153EDA614071A3B7U },
+    { 0x0848F973CB3EE3CEU, 0x10701BD527B4978CU }, { 0x153285EBB9EFBFA2U, 0x196FBB9BB44DB44DU },
+    { 0xADEEE7F86C07B696U, 0x13AE3591F5B4D936U }, { 0x4D686A4EAF182222U, 0x1E74404F3DAADA91U },
+    { 0x98C0A106E09EBD9FU, 0x17900EA4FDA7C257U }, { 0x8F20E37371497D0EU, 0x123B140576D820B2U },
+    { 0xB043138134743D85U, 0x1C35F4275F7A29ADU }
+};
+
+constexpr uint32_t ryu_pow5_inv_offsets_lut[]
+{
+    0x54544554U, 0x04055545U, 0x10041000U, 0x00400414U, 0x40010000U, 0x41155555U,
+    0x00000454U, 0x00010044U, 0x40000000U, 0x44000041U, 0x50454450U, 0x55550054U,
+    0x51655554U, 0x40004000U, 0x01000001U, 0x00010500U, 0x51515411U, 0x05555554U,
+    0x50411500U, 0x40040000U, 0x05040110U, 0x00000000U
+};
+
+constexpr uint64_t ryu_pow5_split_base_lut[][2]
+{
+    { 0x0000000000000000U, 0x1000000000000000U }, { 0x0000000000000000U, 0x14ADF4B7320334B9U },
+    { 0x0E549208B31ADB10U, 0x1ABA4714957D300DU }, { 0x6DC6AD264D8F0866U, 0x1145B7E285BF98F5U },
+    { 0xEB1DBD923D8596CAU, 0x1652EFDC6018A1FCU }, { 0xB4C1B80B22AE923CU, 0x1CDA62055B2D9D83U },
+    { 0x5BB28B4E8F7E4C30U, 0x12A5568B9F52F416U }, { 0xF08AED437682D4FBU, 0x1819651531F9E78FU },
+    { 0xB4EE134AD99BF150U, 0x1F25C186A6F04C28U }, { 0x16499ECB70C25F03U, 0x1420EB449C8842E6U },
+    { 0x85A56EAD360865B0U, 0x1A03FDE214CAF085U }, { 0x093DB1D57999890BU, 0x10CFEB353A97DAD8U },
+    { 0xCF38BB735E3F36ACU, 0x15BAAF44FA52673EU }, { 0xF27D6370146770C0U, 0x1C1599F50EB5E8B4U }
+};
+
+constexpr uint32_t ryu_pow5_offsets_lut[]
+{
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x40000000U, 0x59695995U,
+    0x55545555U, 0x56555515U, 0x41150504U, 0x40555410U, 0x44555145U, 0x44504540U,
+    0x45555550U, 0x40004000U, 0x96440440U, 0x55565565U, 0x54454045U, 0x40154151U,
+    0x55559155U, 0x51405555U, 0x54414105U, 0x00000401U
+};
+
+constexpr uint64_t ryu_pow5_lut[]
+{
+    0x0000000000000001U, 0x0000000000000005U, 0x0000000000000019U, 0x000000000000007DU,
+    0x0000000000000271U, 0x0000000000000C35U, 0x0000000000003D09U, 0x000000000001312DU,
+    0x000000000005F5E1U, 0x00000000001DCD65U, 0x00000000009502F9U, 0x0000000002E90EDDU,
+    0x000000000E8D4A51U, 0x0000000048C27395U, 0x000000016BCC41E9U, 0x000000071AFD498DU,
+    0x0000002386F26FC1U, 0x000000B1A2BC2EC5U, 0x000003782DACE9D9U, 0x00001158E460913DU,
+    0x000056BC75E2D631U, 0x0001B1AE4D6E2EF5U, 0x000878678326EAC9U, 0x002A5A058FC295EDU,
+    0x00D3C21BCECCEDA1U, 0x0422CA8B0A00A425U
+};
+#endif // defined(USF_FLOAT_ENGINE_FAST)
+
+// Ryu lookup tables for single precision: 5^-i (rounded up) normalized to 59
+// bits and 5^i normalized to 61 bits (one 64 bit word each). The 5^-i table
+// goes up to 5^-35 (Ryu stops at 5^-30) to also cover the bfloat16 range.
+constexpr uint64_t ryu_float_pow5_inv_lut[]
+{
+    0x0800000000000001U, 0x0666666666666667U, 0x051EB851EB851EB9U, 0x04189374BC6A7EFAU,
+    0x068DB8BAC710CB2AU, 0x053E2D6238DA3C22U, 0x0431BDE82D7B634EU, 0x06B5FCA6AF2BD216U,
+    0x055E63B88C230E78U, 0x044B82FA09B5A52DU, 0x06DF37F675EF6EAEU, 0x057F5FF85E592558U,
+    0x0465E6604B7A8447U, 0x0709709A125DA071U, 0x05A126E1A84AE6C1U, 0x0480EBE7B9D58567U,
+    0x0734ACA5F6226F0BU, 0x05C3BD5191B525A3U, 0x049C97747490EAE9U, 0x0760F253EDB4AB0EU,
+    0x05E72843249088D8U, 0x04B8ED0283A6D3E0U, 0x078E480405D7B966U, 0x060B6CD004AC9452U,
+    0x04D5F0A66A23A9DBU, 0x07BCB43D769F762BU, 0x063090312BB2C4EFU, 0x04F3A68DBC8F03F3U,
+    0x07EC3DAF94180651U, 0x065697BFA9ACD1DAU, 0x051212FFBAF0A7E2U, 0x040E7599625A1FE8U,
+    0x067D88F56A29CCA6U, 0x05313A5DEE87D6ECU, 0x042761E4BED31256U, 0x06A5696DFE1E83BDU
+};
+
+constexpr uint64_t ryu_float_pow5_lut[]
+{
+    0x1000000000000000U, 0x1400000000000000U, 0x1900000000000000U, 0x1F40000000000000U,
+    0x1388000000000000U, 0x186A000000000000U, 0x1E84800000000000U, 0x1312D00000000000U,
+    0x17D7840000000000U, 0x1DCD650000000000U, 0x12A05F2000000000U, 0x174876E800000000U,
+    0x1D1A94A200000000U, 0x12309CE540000000U, 0x16BCC41E90000000U, 0x1C6BF52634000000U,
+    0x11C37937E0800000U, 0x16345785D8A00000U, 0x1BC16D674EC80000U, 0x1158E460913D0000U,
+    0x15AF1D78B58C4000U, 0x1B1AE4D6E2EF5000U, 0x10F0CF064DD59200U, 0x152D02C7E14AF680U,
+    0x1A784379D99DB420U, 0x108B2A2C28029094U, 0x14ADF4B7320334B9U, 0x19D971E4FE8401E7U,
+    0x1027E72F1F128130U, 0x1431E0FAE6D7217CU, 0x193E5939A08CE9DBU, 0x1F8DEF8808B02452U,
+    0x13B8B5B5056E16B3U, 0x18A6E32246C99C60U, 0x1ED09BEAD87C0378U, 0x13426172C74D822BU,
+    0x1812F9CF7920E2B6U, 0x1E17B84357691B64U, 0x12CED32A16A1B11EU, 0x178287F49C4A1D66U,
+    0x1D6329F1C35CA4BFU, 0x125DFA371A19E6F7U, 0x16F578C4E0A060B5U, 0x1CB2D6F618C878E3U,
+    0x11EFC659CF7D4B8DU, 0x166BB7F0435C9E71U, 0x1C06A5EC5433C60DU, 0x118427B3B4A05BC8U
+};
 
 class Float
 {
     public:
 
+        // --------------------------------------------------------------------
+        // PUBLIC DEFINITIONS
+        // --------------------------------------------------------------------
+
+        // Maximum number of significand digits (size of the conversion buffer)
+        static constexpr int kMaxDigits = USF_FLOAT_EXACT_DIGITS;
+
+        // Size of the conversion buffer for the shortest (all types) and the
+        // low precision conversions (the larger one is only needed above).
+        static constexpr int kSmallDigits = 40;
+
+        static_assert(kMaxDigits >= 20, "Float: USF_FLOAT_EXACT_DIGITS must be at least 20!");
+
         // --------------------------------------------------------------------
         // PUBLIC STATIC FUNCTIONS
         // --------------------------------------------------------------------
 
-        template <typename CharT> static USF_CPP14_CONSTEXPR
-        int convert(CharT* const significand, int& exponent,
-                    double value, const bool format_fixed, const int precision) noexcept
+        // Converts the value (positive, finite and non zero) to the shortest
+        // significand that parses back to the same value. Returns the number
+        // of significand digits and the (scientific notation) exponent.
+        template <typename CharT> static
+        int convert_shortest(CharT* const significand, int& exponent, const double value) noexcept
         {
-            uint64_t ipart = 0;
-            uint64_t fpart = 0;
+#if defined(USF_FLOAT_ENGINE_EXACT)
+            return convert_shortest_wide(significand, exponent, decode(value));
+#else
+            uint64_t digits = 0;
 
-            int ipart_digits = 0;
-            int fpart_digits = 0;
+            shortest(digits, exponent, value);
 
-            int fpart_padding = 0;
+            const auto significand_size = Integer::count_digits_dec(digits);
 
-            if(value < 1)
-            {
-                // Negative exponent
+            Integer::convert_dec(significand + significand_size, digits);
+
+            exponent += significand_size - 1;
+
+            return significand_size;
+#endif
+        }
 
-                value *= 1e19;
+#if !defined(USF_FLOAT_ENGINE_EXACT)
+        // Shortest decimal representation (`digits` * 10^`exponent`) of the
+        // value (positive, finite and non zero) that parses back to it.
+        static void shortest(uint64_t& digits, int& exponent, const double value) noexcept
+        {
+            const uint64_t bits = bit_cast(value);
 
-                fpart = static_cast<uint64_t>(value);
-                fpart_digits = Integer::count_digits_dec(fpart);
+            const uint64_t ieee_mantissa = bits & ((UINT64_C(1) << 52U) - 1);
+            const auto     ieee_exponent = static_cast<int>(bits >> 52U);
 
-                exponent = fpart_digits - 20;
+            assert(ieee_exponent > 0 || ieee_mantissa != 0);
+            assert(ieee_exponent < 2047);
 
-                fpart_padding = -exponent - 1;
+            if(ieee_exponent >= 1023 && ieee_exponent <= 1023 + 52)
+            {
+                // Small integers [1, 2^53) are converted directly
+                const auto e2 = static_cast<unsigned>(1023 + 52 - ieee_exponent);
+                const uint64_t m2 = (UINT64_C(1) << 52U) | ieee_mantissa;
 
-                //if(!format_fixed && precision > 19 - fpart_padding)
-                if(fpart_padding > 14 - precision)
+                if((m2 & ((UINT64_C(1) << e2) - 1)) == 0)
                 {
-                    fpart = static_cast<uint64_t>(value * static_cast<double>(Integer::pow10_uint64(fpart_padding)));
-                    fpart_digits = Integer::count_digits_dec(fpart);
+                    digits = m2 >> e2;
+                    exponent = 0;
+
+                    while(digits % 10 == 0)
+                    {
+                        digits /= 10;
+                        ++exponent;
+                    }
+
+                    return;
                 }
             }
-            else
-            {
-                // Positive exponent
 
-                ipart = static_cast<uint64_t>(value);
-                ipart_digits = Integer::count_digits_dec(ipart);
+            shortest(digits, exponent, ieee_mantissa, ieee_exponent);
+        }
+#endif
+
+        // Single precision version of the above (much smaller tables and only
+        // 64 bit arithmetic). The digits are the shortest ones that parse back
+        // to the same float, not to the same double.
+        template <typename CharT> static
+        int convert_shortest(CharT* const significand, int& exponent, const float value) noexcept
+        {
+            uint32_t digits = 0;
 
-                fpart = static_cast<uint64_t>((value - static_cast<double>(ipart)) * 1e14);
-                fpart_digits = Integer::count_digits_dec(fpart);
+            shortest(digits, exponent, value);
 
-                exponent = ipart_digits - 1;
+            const auto significand_size = Integer::count_digits_dec(digits);
 
-                fpart_padding = 14 - fpart_digits;
-            }
+            Integer::convert_dec(significand + significand_size, digits);
+
+            exponent += significand_size - 1;
+
+            return significand_size;
+        }
+
+        static void shortest(uint32_t& digits, int& exponent, const float value) noexcept
+        {
+            const uint32_t bits = bit_cast(value);
+
+            const uint32_t ieee_mantissa = bits & ((UINT32_C(1) << 23U) - 1);
+            const auto     ieee_exponent = static_cast<int>(bits >> 23U);
+
+            assert(ieee_exponent > 0 || ieee_mantissa != 0);
+            assert(ieee_exponent < 255);
+
+            shortest(digits, exponent, ieee_mantissa, ieee_exponent);
+        }
+
+        // Converts the value (positive, finite and non zero) to a significand
+        // correctly rounded to `precision` digits after the first one
+        // (scientific) or after the decimal point (fixed). The `significand`
+        // buffer has `max_digits` elements, at least `kSmallDigits`. Returns
+        // the number of significand digits (trailing zeros removed unless
+        // fixed format is rounded), or 0 if a smaller buffer than `kMaxDigits`
+        // can't hold the digits up to the rounding one.
+        template <typename CharT> static
+        int convert(CharT* const significand, int& exponent,
+                    const double value, const bool format_fixed, const int precision,
+                    const int max_digits = kMaxDigits) noexcept
+        {
+#if defined(USF_FLOAT_ENGINE_EXACT)
+            return convert_wide(significand, exponent, decode(value), format_fixed, precision, max_digits);
+#else
+            uint64_t digits = 0;
+            bool exact = false;
+
+            truncated(digits, exponent, exact, value);
+
+            auto digits_size = Integer::count_digits_dec(digits);
+
+            Integer::convert_dec(significand + digits_size, digits);
+
+            exponent += digits_size - 1;
 
             const auto round_index = 1 + precision + (format_fixed ? exponent : 0);
 
@@ -81,26 +666,18 @@ class Float
                 return 1;
             }
 
-            CharT* it = significand;
-
-            if(ipart != 0)
+            if(round_index >= digits_size && !exact)
             {
-                it += ipart_digits;
-                Integer::convert_dec(it, ipart);
-            }
+                // Not enough digits to round: exact conversion of the digits
+                // up to the rounding one (limited by the buffer size).
+                if(round_index >= max_digits && max_digits < kMaxDigits) { return 0; }
 
-            if(fpart != 0)
-            {
-                if(ipart != 0)
-                {
-                    CharTraits::assign(it, '0', fpart_padding);
-                }
+                digits_size = (round_index < kMaxDigits) ? round_index + 1 : kMaxDigits;
 
-                it += fpart_digits;
-                Integer::convert_dec(it, fpart);
+                exact_digits(significand, digits_size, exact, exponent, value);
             }
 
-            const auto significand_size = remove_trailing_zeros(significand, it);
+            const auto significand_size = remove_trailing_zeros(significand, significand + digits_size);
 
             if(significand_size <= round_index)
             {
@@ -109,26 +686,1669 @@ class Float
             }
 
             //Round to the specified precision.
-            return round(significand, significand_size, exponent, format_fixed, round_index);
+            return round(significand, significand_size, exponent, format_fixed, round_index, exact);
+#endif
+        }
+
+        // A float is exactly represented as a double, so the fixed precision
+        // conversion is the same.
+        template <typename CharT> static
+        int convert(CharT* const significand, int& exponent,
+                    const float value, const bool format_fixed, const int precision,
+                    const int max_digits = kMaxDigits) noexcept
+        {
+            return convert(significand, exponent, static_cast<double>(value), format_fixed, precision, max_digits);
+        }
+
+        // -------- 16 BIT FLOATING POINT -------------------------------------
+        // The binary16 and bfloat16 values are in the single precision range
+        // (narrower mantissas), so the shortest conversion is the single
+        // precision one with their own rounding interval. Both are exactly
+        // represented as a double, so the fixed precision conversion is the
+        // same.
+        // --------------------- ----------------------------------------------
+        template <typename CharT> static
+        int convert_shortest(CharT* const significand, int& exponent, const Float16 value) noexcept
+        {
+            return convert_shortest_narrow(significand, exponent, value.bits() & 0x3FFU, (value.bits() >> 10U) & 0x1FU, 10, 15);
+        }
+
+        template <typename CharT> static
+        int convert_shortest(CharT* const significand, int& exponent, const BFloat16 value) noexcept
+        {
+            return convert_shortest_narrow(significand, exponent, value.bits() & 0x7FU, (value.bits() >> 7U) & 0xFFU, 7, 127);
+        }
+
+        template <typename CharT> static
+        int convert(CharT* const significand, int& exponent,
+                    const Float16 value, const bool format_fixed, const int precision,
+                    const int max_digits = kMaxDigits) noexcept
+        {
+            return convert(significand, exponent, to_double(value), format_fixed, precision, max_digits);
+        }
+
+        template <typename CharT> static
+        int convert(CharT* const significand, int& exponent,
+                    const BFloat16 value, const bool format_fixed, const int precision,
+                    const int max_digits = kMaxDigits) noexcept
+        {
+            return convert(significand, exponent, to_double(value), format_fixed, precision, max_digits);
+        }
+
+        static int convert_hex(uint64_t& significand, const Float16 value, const int precision) noexcept
+        {
+            return convert_hex(significand, to_double(value), precision);
+        }
+
+        static int convert_hex(uint64_t& significand, const BFloat16 value, const int precision) noexcept
+        {
+            return convert_hex(significand, to_double(value), precision);
+        }
+
+        // Hexadecimal significand of the value (positive and finite): the
+        // leading digit (0 for zero and subnormals, 1 otherwise or 2 if rounded
+        // up) in the bits [52, 63] followed by the 13 fraction digits. If the
+        // `precision` is not negative, the fraction is rounded to `precision`
+        // digits (to nearest, ties to even). Returns the binary exponent.
+        static int convert_hex(uint64_t& significand, const double value, const int precision) noexcept
+        {
+            const uint64_t bits = bit_cast(value);
+
+            const uint64_t ieee_mantissa = bits & ((UINT64_C(1) << 52U) - 1);
+            const auto     ieee_exponent = static_cast<int>(bits >> 52U);
+
+            int exponent = 0;
+
+            if(ieee_exponent == 0)
+            {
+                // Zero or subnormal
+                significand = ieee_mantissa;
+                exponent = (ieee_mantissa == 0) ? 0 : 1 - 1023;
+            }
+            else
+            {
+                significand = (UINT64_C(1) << 52U) | ieee_mantissa;
+                exponent = ieee_exponent - 1023;
+            }
+
+            if(precision >= 0 && precision < 13)
+            {
+                const auto shift = static_cast<unsigned>(4 * (13 - precision));
+
+                const uint64_t remainder = significand & ((UINT64_C(1) << shift) - 1);
+                const uint64_t half = UINT64_C(1) << (shift - 1);
+
+                significand >>= shift;
+
+                if(remainder > half || (remainder == half && (significand & 1) != 0)) { ++significand; }
+
+                significand <<= shift;
+            }
+
+            return exponent;
+        }
+
+        // A float is exactly represented as a double (printed as a double
+        // by printf too).
+        static int convert_hex(uint64_t& significand, const float value, const int precision) noexcept
+        {
+            return convert_hex(significand, static_cast<double>(value), precision);
+        }
+
+        // -------- SCALED ROUNDING -------------------------------------------
+        // The value (positive) times 10^`precision` (in the range [0, 9])
+        // rounded to the nearest integer as its exact decimal expansion would
+        // be (ties to even). Since the rounding of the product is monotonic
+        // and the halfway points below 2^52 are exactly representable, the
+        // rounded product is only ambiguous when it is exactly halfway. Then
+        // the sign of the product error decides. Returns false if the result
+        // needs more than 52 bits (or the value is not finite).
+        // --------------------- ----------------------------------------------
+        static bool round_scaled(uint64_t& scaled, const double value, const int precision) noexcept
+        {
+            assert(precision >= 0 && precision < 10);
+
+            const auto scale = static_cast<double>(Integer::pow10_uint32(precision));
+            const double product = value * scale;
+
+            // Also false for NaN
+            if(!(product < 4503599627370496.0)) { return false; }
+
+            scaled = static_cast<uint64_t>(product);
+
+            // Exact (the product has no bits below 2^-52 of its integer part)
+            const double fraction = product - static_cast<double>(scaled);
+
+            if(fraction > 0.5)
+            {
+                ++scaled;
+            }
+            else if(!(fraction < 0.5))
+            {
+                const double error = product_error(value, scale, product);
+
+                if(error > 0 || (!(error < 0) && (scaled & 1U) != 0)) { ++scaled; }
+            }
+
+            return true;
+        }
+
+#if defined(USF_SIMD_SSE2)
+        // Two lanes version of round_scaled(). Returns a mask of the lanes
+        // (bit 0 for the first value) with a valid scaled value. The other
+        // ones (halfway or out of range) must use the scalar function.
+        static int round_scaled_sse2(uint64_t* const scaled, const double* const values, const int precision) noexcept
+        {
+            return round_scaled_sse2(scaled, _mm_loadu_pd(values), precision);
+        }
+
+        static int round_scaled_sse2(uint64_t* const scaled, const float* const values, const int precision) noexcept
+        {
+            __m128 pair = _mm_setzero_ps();
+            std::memcpy(&pair, values, 2 * sizeof(float));
+
+            return round_scaled_sse2(scaled, _mm_cvtps_pd(pair), precision);
+        }
+#endif
+
+#if !defined(USF_FLOAT_ENGINE_EXACT)
+        // Truncated decimal representation (`digits` * 10^`exponent`, 17 to
+        // 19 digits) of the value (positive, finite and non zero). `exact` is
+        // set when no other non-zero digits follow the truncated ones.
+        static void truncated(uint64_t& digits, int& exponent, bool& exact, const double value) noexcept
+        {
+            const uint64_t bits = bit_cast(value);
+
+            const uint64_t ieee_mantissa = bits & ((UINT64_C(1) << 52U) - 1);
+            const auto     ieee_exponent = static_cast<int>(bits >> 52U);
+
+            assert(ieee_exponent > 0 || ieee_mantissa != 0);
+            assert(ieee_exponent < 2047);
+
+            truncated(digits, exponent, exact, ieee_mantissa, ieee_exponent);
+        }
+#endif
+
+        // Floating point category (FP_NAN, FP_INFINITE, FP_ZERO, FP_SUBNORMAL
+        // or FP_NORMAL) and sign of the value.
+        template <typename T> static
+        int classify(const T value) noexcept { return std::fpclassify(value); }
+
+        template <typename T> static
+        bool sign_bit(const T value) noexcept { return std::signbit(value); }
+
+        static int classify(const Float16 value) noexcept
+        {
+            return classify_narrow(value.bits() & 0x3FFU, (value.bits() >> 10U) & 0x1FU, 0x1FU);
+        }
+
+        static int classify(const BFloat16 value) noexcept
+        {
+            return classify_narrow(value.bits() & 0x7FU, (value.bits() >> 7U) & 0xFFU, 0xFFU);
+        }
+
+        static bool sign_bit(const Float16  value) noexcept { return (value.bits() & 0x8000U) != 0; }
+        static bool sign_bit(const BFloat16 value) noexcept { return (value.bits() & 0x8000U) != 0; }
+
+#if defined(USF_FLOAT128_SUPPORT)
+        static int classify(const float128_t value) noexcept
+        {
+            const WideFloat wide = decode(value);
+
+            if(wide.ieee_exponent == 0x7FFF) { return wide.fraction_zero ? FP_INFINITE : FP_NAN; }
+            if(wide.ieee_exponent == 0     ) { return wide.fraction_zero ? FP_ZERO : FP_SUBNORMAL; }
+
+            return FP_NORMAL;
         }
 
+        static bool sign_bit(const float128_t value) noexcept { return decode(value).negative; }
+#endif
+
+#if defined(USF_FLOAT_EXTENDED_SUPPORT)
+        // -------- EXTENDED PRECISION CONVERSION -----------------------------
+        // The long double (x87 80 bit or IEEE binary128) and __float128 values
+        // (positive, finite and non zero) are converted exactly with multiple
+        // precision arithmetic instead of lookup tables. Same interface and
+        // results as the double conversion functions.
+        // --------------------- ----------------------------------------------
+#if defined(USF_LONG_DOUBLE_X87) || defined(USF_LONG_DOUBLE_BINARY128)
+        template <typename CharT> static
+        int convert_shortest(CharT* const significand, int& exponent, const long double value) noexcept
+        {
+            return convert_shortest_wide(significand, exponent, decode(value));
+        }
+
+        template <typename CharT> static
+        int convert(CharT* const significand, int& exponent,
+                    const long double value, const bool format_fixed, const int precision,
+                    const int max_digits = kMaxDigits) noexcept
+        {
+            return convert_wide(significand, exponent, decode(value), format_fixed, precision, max_digits);
+        }
+#endif
+
+#if defined(USF_FLOAT128_SUPPORT)
+        template <typename CharT> static
+        int convert_shortest(CharT* const significand, int& exponent, const float128_t value) noexcept
+        {
+            return convert_shortest_wide(significand, exponent, decode(value));
+        }
+
+        template <typename CharT> static
+        int convert(CharT* const significand, int& exponent,
+                    const float128_t value, const bool format_fixed, const int precision,
+                    const int max_digits = kMaxDigits) noexcept
+        {
+            return convert_wide(significand, exponent, decode(value), format_fixed, precision, max_digits);
+        }
+#endif
+#endif // defined(USF_FLOAT_EXTENDED_SUPPORT)
+
         private:
 
         // --------------------------------------------------------------------
         // PRIVATE STATIC FUNCTIONS
         // --------------------------------------------------------------------
 
+#if !defined(USF_FLOAT_ENGINE_EXACT)
+        // -------- SHORTEST CONVERSION (RYU) ---------------------------------
+        // The interval of real numbers that round to the value is computed
+        // exactly (scaled by a power of 10) and the shortest decimal number
+        // inside it is searched removing digits from the interval bounds.
+        // Based on the code from: https://github.com/ulfjack/ryu (d2s.c)
+        // --------------------- ----------------------------------------------
+        static USF_CPP14_CONSTEXPR void shortest(uint64_t& digits, int& exponent,
+                                                 const uint64_t ieee_mantissa, const int ieee_exponent) noexcept
+        {
+            int e2 = 0;
+            uint64_t m2 = 0;
+
+            if(ieee_exponent == 0)
+            {
+                // Subnormal
+                e2 = 1 - 1023 - 52 - 2;
+                m2 = ieee_mantissa;
+            }
+            else
+            {
+                e2 = ieee_exponent - 1023 - 52 - 2;
+                m2 = (UINT64_C(1) << 52U) | ieee_mantissa;
+            }
+
+            const bool accept_bounds = (m2 & 1) == 0;
+
+            // Interval bounds (4 times the value and its neighbors halfway points)
+            const uint64_t mv = 4 * m2;
+            const uint32_t mm_shift = (ieee_mantissa != 0 || ieee_exponent <= 1) ? 1 : 0;
+
+            uint64_t vr = 0;
+            uint64_t vp = 0;
+            uint64_t vm = 0;
+
+            int e10 = 0;
+
+            bool vm_trailing_zeros = false;
+            bool vr_trailing_zeros = false;
+
+            if(e2 >= 0)
+            {
+                const int q = log10_pow2(e2) - static_cast<int>(e2 > 3);
+                const int k = 125 + pow5_bits(q) - 1;
+                const int i = -e2 + q + k;
+
+                e10 = q;
+
+                uint64_t pow5[2]{};
+
+                vr = mul_shift(mv, mm_shift, pow5_inv_split(q, pow5), i, vp, vm);
+
+                if(q <= 21)
+                {
+                    // Only one of mp, mv, and mm can be a multiple of 5, if any
+                    if(mv % 5 == 0)
+                    {
+                        vr_trailing_zeros = multiple_of_pow5(mv, q);
+                    }
+                    else if(accept_bounds)
+                    {
+                        vm_trailing_zeros = multiple_of_pow5(mv - 1 - mm_shift, q);
+                    }
+                    else
+                    {
+                        vp -= static_cast<uint64_t>(multiple_of_pow5(mv + 2, q));
+                    }
+                }
+            }
+            else
+            {
+                const int q = log10_pow5(-e2) - static_cast<int>(-e2 > 1);
+                const int i = -e2 - q;
+                const int k = pow5_bits(i) - 125;
+                const int j = q - k;
+
+                e10 = q + e2;
+
+                uint64_t pow5[2]{};
+
+                vr = mul_shift(mv, mm_shift, pow5_split(i, pow5), j, vp, vm);
+
+                if(q <= 1)
+                {
+                    // mv = 4 * m2 has at least 2 trailing 0 bits
+                    vr_trailing_zeros = true;
+
+                    if(accept_bounds)
+                    {
+                        // mm = mv - 1 - mm_shift has 1 trailing 0 bit iff mm_shift == 1
+                        vm_trailing_zeros = (mm_shift == 1);
+                    }
+                    else
+                    {
+                        // mp = mv + 2 has 1 trailing 0 bit
+                        --vp;
+                    }
+                }
+                else if(q < 63)
+                {
+                    vr_trailing_zeros = (mv & ((UINT64_C(1) << static_cast<unsigned>(q)) - 1)) == 0;
+                }
+            }
+
+            // Remove the digits while the interval bounds have common prefix
+            int removed = 0;
+            uint64_t last_removed_digit = 0;
+
+            if(vm_trailing_zeros || vr_trailing_zeros)
+            {
+                // Uncommon case (about 0.5% of the values)
+                for(; vp / 10 > vm / 10; ++removed)
+                {
+                    vm_trailing_zeros &= (vm % 10 == 0);
+                    vr_trailing_zeros &= (last_removed_digit == 0);
+                    last_removed_digit = vr % 10;
+                    vr /= 10;
+                    vp /= 10;
+                    vm /= 10;
+                }
+
+                if(vm_trailing_zeros)
+                {
+                    for(; vm % 10 == 0; ++removed)
+                    {
+                        vr_trailing_zeros &= (last_removed_digit == 0);
+                        last_removed_digit = vr % 10;
+                        vr /= 10;
+                        vp /= 10;
+                        vm /= 10;
+                    }
+                }
+
+                if(vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+                {
+                    // Round even if the exact number is .....50..0
+                    last_removed_digit = 4;
+                }
+
+                digits = vr + static_cast<uint64_t>((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+            }
+            else
+            {
+                // Common case
+                bool round_up = false;
+
+                if(vp / 100 > vm / 100)
+                {
+                    // Optimization: remove two digits at a time
+                    round_up = (vr % 100 >= 50);
+                    vr /= 100;
+                    vp /= 100;
+                    vm /= 100;
+                    removed += 2;
+                }
+
+                for(; vp / 10 > vm / 10; ++removed)
+                {
+                    round_up = (vr % 10 >= 5);
+                    vr /= 10;
+                    vp /= 10;
+                    vm /= 10;
+                }
+
+                digits = vr + static_cast<uint64_t>(vr == vm || round_up);
+            }
+
+            exponent = e10 + removed;
+        }
+#endif // !defined(USF_FLOAT_ENGINE_EXACT)
+
+        // -------- SHORTEST CONVERSION (RYU, SINGLE PRECISION) ---------------
+        // Same algorithm as above with 32 bit interval bounds. Since the
+        // bounds are not shortened by one digit in advance, the last removed
+        // digit is computed separately when needed.
+        // Based on the code from: https://github.com/ulfjack/ryu (f2s.c)
+        // --------------------- ----------------------------------------------
+        static USF_CPP14_CONSTEXPR void shortest(uint32_t& digits, int& exponent,
+                                                 const uint32_t ieee_mantissa, const int ieee_exponent) noexcept
+        {
+            if(ieee_exponent == 0)
+            {
+                // Subnormal
+                shortest_ryu32(digits, exponent, ieee_mantissa, 1 - 127 - 23, false);
+            }
+            else
+            {
+                shortest_ryu32(digits, exponent, (UINT32_C(1) << 23U) | ieee_mantissa, ieee_exponent - 127 - 23,
+                               ieee_mantissa == 0 && ieee_exponent > 1);
+            }
+        }
+
+        // Value m2 * 2^e2 (m2 up to 24 bits and e2 in the single precision
+        // range, so the narrower binary16 and bfloat16 formats too), with the
+        // lower neighbor closer than the upper one at the powers of 2.
+        static USF_CPP14_CONSTEXPR void shortest_ryu32(uint32_t& digits, int& exponent, const uint32_t m2,
+                                                       int e2, const bool lower_boundary_closer) noexcept
+        {
+            e2 -= 2;
+
+            const bool accept_bounds = (m2 & 1) == 0;
+
+            // Interval bounds (4 times the value and its neighbors halfway points)
+            const uint32_t mm_shift = lower_boundary_closer ? 0 : 1;
+
+            const uint32_t mv = 4 * m2;
+            const uint32_t mp = 4 * m2 + 2;
+            const uint32_t mm = 4 * m2 - 1 - mm_shift;
+
+            uint32_t vr = 0;
+            uint32_t vp = 0;
+            uint32_t vm = 0;
+
+            int e10 = 0;
+
+            bool vm_trailing_zeros = false;
+            bool vr_trailing_zeros = false;
+
+            uint32_t last_removed_digit = 0;
+
+            if(e2 >= 0)
+            {
+                const int q = log10_pow2(e2);
+                const int k = 59 + pow5_bits(q) - 1;
+                const int i = -e2 + q + k;
+
+                e10 = q;
+
+                vr = mul_shift32(mv, ryu_float_pow5_inv_lut[q], i);
+                vp = mul_shift32(mp, ryu_float_pow5_inv_lut[q], i);
+                vm = mul_shift32(mm, ryu_float_pow5_inv_lut[q], i);
+
+                if(q != 0 && (vp - 1) / 10 <= vm / 10)
+                {
+                    // The loop below removes no digits, but the last one is needed
+                    const int l = 59 + pow5_bits(q - 1) - 1;
+                    last_removed_digit = mul_shift32(mv, ryu_float_pow5_inv_lut[q - 1], -e2 + q - 1 + l) % 10;
+                }
+
+                if(q <= 9)
+                {
+                    // Only one of mp, mv, and mm can be a multiple of 5, if any
+                    if(mv % 5 == 0)
+                    {
+                        vr_trailing_zeros = multiple_of_pow5(mv, q);
+                    }
+                    else if(accept_bounds)
+                    {
+                        vm_trailing_zeros = multiple_of_pow5(mm, q);
+                    }
+                    else
+                    {
+                        vp -= static_cast<uint32_t>(multiple_of_pow5(mp, q));
+                    }
+                }
+            }
+            else
+            {
+                const int q = log10_pow5(-e2);
+                const int i = -e2 - q;
+                const int k = pow5_bits(i) - 61;
+                const int j = q - k;
+
+                e10 = q + e2;
+
+                vr = mul_shift32(mv, ryu_float_pow5_lut[i], j);
+                vp = mul_shift32(mp, ryu_float_pow5_lut[i], j);
+                vm = mul_shift32(mm, ryu_float_pow5_lut[i], j);
+
+                if(q != 0 && (vp - 1) / 10 <= vm / 10)
+                {
+                    // The loop below removes no digits, but the last one is needed
+                    const int l = q - 1 - (pow5_bits(i + 1) - 61);
+                    last_removed_digit = mul_shift32(mv, ryu_float_pow5_lut[i + 1], l) % 10;
+                }
+
+                if(q <= 1)
+                {
+                    // mv = 4 * m2 has at least 2 trailing 0 bits
+                    vr_trailing_zeros = true;
+
+                    if(accept_bounds)
+                    {
+                        // mm = mv - 1 - mm_shift has 1 trailing 0 bit iff mm_shift == 1
+                        vm_trailing_zeros = (mm_shift == 1);
+                    }
+                    else
+                    {
+                        // mp = mv + 2 has 1 trailing 0 bit
+                        --vp;
+                    }
+                }
+                else if(q < 31)
+                {
+                    vr_trailing_zeros = (mv & ((UINT32_C(1) << static_cast<unsigned>(q - 1)) - 1)) == 0;
+                }
+            }
+
+            // Remove the digits while the interval bounds have common prefix
+            int removed = 0;
+
+            if(vm_trailing_zeros || vr_trailing_zeros)
+            {
+                // Uncommon case
+                for(; vp / 10 > vm / 10; ++removed)
+                {
+                    vm_trailing_zeros &= (vm % 10 == 0);
+                    vr_trailing_zeros &= (last_removed_digit == 0);
+                    last_removed_digit = vr % 10;
+                    vr /= 10;
+                    vp /= 10;
+                    vm /= 10;
+                }
+
+                if(vm_trailing_zeros)
+                {
+                    for(; vm % 10 == 0; ++removed)
+                    {
+                        vr_trailing_zeros &= (last_removed_digit == 0);
+                        last_removed_digit = vr % 10;
+                        vr /= 10;
+                        vp /= 10;
+                        vm /= 10;
+                    }
+                }
+
+                if(vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+                {
+                    // Round even if the exact number is .....50..0
+                    last_removed_digit = 4;
+                }
+
+                digits = vr + static_cast<uint32_t>((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+            }
+            else
+            {
+                // Common case
+                for(; vp / 10 > vm / 10; ++removed)
+                {
+                    last_removed_digit = vr % 10;
+                    vr /= 10;
+                    vp /= 10;
+                    vm /= 10;
+                }
+
+                digits = vr + static_cast<uint32_t>(vr == vm || last_removed_digit >= 5);
+            }
+
+            exponent = e10 + removed;
+        }
+
+        // Computes m * mul >> j (32 x 64 bit multiplication, j in [32, 96)).
+        static USF_CPP14_CONSTEXPR uint32_t mul_shift32(const uint32_t m, const uint64_t mul, const int j) noexcept
+        {
+            assert(j >= 32 && j < 96);
+
+            const uint64_t low  = static_cast<uint64_t>(m) * (mul & 0xFFFFFFFFU);
+            const uint64_t high = static_cast<uint64_t>(m) * (mul >> 32U);
+
+            return static_cast<uint32_t>(((low >> 32U) + high) >> static_cast<unsigned>(j - 32));
+        }
+
+        // -------- 16 BIT FLOATING POINT HELPERS -----------------------------
+        // Decoding of the binary16 (10 bit mantissa, bias 15) and bfloat16
+        // (7 bit mantissa, bias 127) fields.
+        // --------------------- ----------------------------------------------
+        template <typename CharT> static
+        int convert_shortest_narrow(CharT* const significand, int& exponent, const uint32_t ieee_mantissa,
+                                    const uint32_t ieee_exponent, const unsigned mantissa_bits, const int bias) noexcept
+        {
+            assert(ieee_exponent > 0 || ieee_mantissa != 0);
+
+            uint32_t digits = 0;
+
+            if(ieee_exponent == 0)
+            {
+                // Subnormal
+                shortest_ryu32(digits, exponent, ieee_mantissa, 1 - bias - static_cast<int>(mantissa_bits), false);
+            }
+            else
+            {
+                shortest_ryu32(digits, exponent, (UINT32_C(1) << mantissa_bits) | ieee_mantissa,
+                               static_cast<int>(ieee_exponent) - bias - static_cast<int>(mantissa_bits),
+                               ieee_mantissa == 0 && ieee_exponent > 1);
+            }
+
+            const auto significand_size = Integer::count_digits_dec(digits);
+
+            Integer::convert_dec(significand + significand_size, digits);
+
+            exponent += significand_size - 1;
+
+            return significand_size;
+        }
+
+        // Exact conversion to double (special values kept)
+        static double to_double(const Float16 value) noexcept
+        {
+            const uint32_t ieee_mantissa = value.bits() & 0x3FFU;
+            const uint32_t ieee_exponent = (value.bits() >> 10U) & 0x1FU;
+
+            if(ieee_exponent == 0)
+            {
+                // Subnormal (or zero): mantissa * 2^-24
+                const double magnitude = static_cast<double>(ieee_mantissa) * 5.9604644775390625e-08;
+
+                return sign_bit(value) ? -magnitude : magnitude;
+            }
+
+            // Same mantissa (left aligned) and exponent rebiased (infinity and nan kept)
+            const uint64_t sign     = static_cast<uint64_t>(value.bits() & 0x8000U) << 48U;
+            const uint64_t exponent = (ieee_exponent == 0x1FU) ? 0x7FFU : ieee_exponent - 15 + 1023;
+
+            const uint64_t bits = sign | (exponent << 52U) | (static_cast<uint64_t>(ieee_mantissa) << 42U);
+
+            double result = 0;
+
+            std::memcpy(&result, &bits, sizeof(result));
+
+            return result;
+        }
+
+        static double to_double(const BFloat16 value) noexcept
+        {
+            // The upper half of a float
+            const uint32_t bits = static_cast<uint32_t>(value.bits()) << 16U;
+
+            float result = 0;
+
+            std::memcpy(&result, &bits, sizeof(result));
+
+            return static_cast<double>(result);
+        }
+
+        static int classify_narrow(const uint32_t ieee_mantissa, const uint32_t ieee_exponent, const uint32_t max_exponent) noexcept
+        {
+            if(ieee_exponent == max_exponent) { return (ieee_mantissa == 0) ? FP_INFINITE : FP_NAN; }
+            if(ieee_exponent == 0           ) { return (ieee_mantissa == 0) ? FP_ZERO : FP_SUBNORMAL; }
+
+            return FP_NORMAL;
+        }
+
+#if !defined(USF_FLOAT_ENGINE_EXACT)
+        // -------- TRUNCATED CONVERSION --------------------------------------
+        // Same scaling as the shortest conversion but only for the value
+        // itself (no interval). The mantissa of the subnormals is normalized
+        // so that all the values get the same number of exact digits.
+        // --------------------------------------------------------------------
+        static USF_CPP14_CONSTEXPR void truncated(uint64_t& digits, int& exponent, bool& exact,
+                                                  uint64_t ieee_mantissa, const int ieee_exponent) noexcept
+        {
+            int e2 = ieee_exponent - 1023 - 52 - 2;
+
+            if(ieee_exponent == 0)
+            {
+                // Subnormal
+                e2 = 1 - 1023 - 52 - 2;
+
+                while((ieee_mantissa & (UINT64_C(1) << 52U)) == 0)
+                {
+                    ieee_mantissa <<= 1U;
+                    --e2;
+                }
+            }
+
+            const uint64_t mv = 4 * ((UINT64_C(1) << 52U) | ieee_mantissa);
+
+            if(e2 >= 0)
+            {
+                const int q = log10_pow2(e2) - static_cast<int>(e2 > 3);
+                const int k = 125 + pow5_bits(q) - 1;
+                const int i = -e2 + q + k;
+
+                uint64_t pow5[2]{};
+
+                exponent = q;
+                digits = mul_shift(mv, pow5_inv_split(q, pow5), i);
+
+                // The value is an integer, exact only if multiple of 5^q
+                exact = multiple_of_pow5(mv, q);
+            }
+            else
+            {
+                const int q = log10_pow5(-e2) - static_cast<int>(-e2 > 1);
+                const int i = -e2 - q;
+                const int k = pow5_bits(i) - 125;
+                const int j = q - k;
+
+                uint64_t pow5[2]{};
+
+                exponent = q + e2;
+                digits = mul_shift(mv, pow5_split(i, pow5), j);
+
+                // Exact only if the (scaled) value is a multiple of 2^q
+                exact = (q < 64 && (mv & ((UINT64_C(1) << static_cast<unsigned>(q)) - 1)) == 0);
+            }
+        }
+#endif // !defined(USF_FLOAT_ENGINE_EXACT)
+
+        // -------- EXACT CONVERSION ------------------------------------------
+        // The value is split in its integer part and its fraction (a numerator
+        // over 2^e). The integer part is converted by repeated division by 10^9
+        // and the fraction by repeated multiplication by 10^9, taking the bits
+        // above the binary point as the next 9 digits. Both work on 32 bit
+        // limbs (only 64 bit arithmetic), with the value on the stack (35
+        // limbs cover the 1024 bits integers and the 1074 bits fractions).
+        // --------------------- ----------------------------------------------
+        template <typename CharT> static
+        void exact_digits(CharT* const significand, const int count, bool& exact,
+                          const int exponent, const double value) noexcept
+        {
+            const uint64_t bits = bit_cast(value);
+
+            const uint64_t ieee_mantissa = bits & ((UINT64_C(1) << 52U) - 1);
+            const auto     ieee_exponent = static_cast<int>(bits >> 52U);
+
+            // value = m2 * 2^e2
+            const uint64_t m2 = (ieee_exponent == 0) ? ieee_mantissa : (UINT64_C(1) << 52U) | ieee_mantissa;
+            const int      e2 = (ieee_exponent == 0) ? 1 - 1023 - 52 : ieee_exponent - 1023 - 52;
+
+            uint32_t limbs[35]{};
+
+            exact = true;
+
+            if(e2 >= 0)
+            {
+                // Integer (up to 1024 bits): the digits are written from back to
+                // front, the ones that do not fit the buffer only set the flag.
+                const auto shift = static_cast<unsigned>(e2) % 32U;
+
+                const uint64_t lo = m2 << shift;
+                const uint64_t hi = (shift == 0) ? 0 : m2 >> (64U - shift);
+
+                int top = e2 / 32;
+
+                limbs[top++] = static_cast<uint32_t>(lo);
+                limbs[top++] = static_cast<uint32_t>(lo >> 32U);
+                limbs[top  ] = static_cast<uint32_t>(hi);
+
+                for(int pos = exponent; pos >= 0; pos -= 9)
+                {
+                    uint32_t chunk = divide_1e9(limbs, top);
+
+                    for(int i = pos; i > pos - 9 && i >= 0; --i)
+                    {
+                        const auto digit = static_cast<CharT>('0' + chunk % 10);
+
+                        if(i < count) { significand[i] = digit; }
+                        else if(digit != '0') { exact = false; }
+
+                        chunk /= 10;
+                    }
+                }
+
+                if(exponent + 1 < count)
+                {
+                    CharT* it = significand + exponent + 1;
+                    CharTraits::assign(it, '0', count - exponent - 1);
+                }
+
+                return;
+            }
+
+            const auto e = static_cast<unsigned>(-e2);
+
+            // Position of the first fraction digit (negative while skipping
+            // the fraction leading zeros of the values less than 1).
+            int pos = exponent + 1;
+
+            // Integer part (up to 53 bits, always less digits than `count`)
+            const uint64_t ipart = (e < 64) ? m2 >> e : 0;
+
+            if(ipart != 0) { Integer::convert_dec(significand + pos, ipart); }
+
+            // Fraction (the binary point is at the bit `e`)
+            const uint64_t fpart = (e < 64) ? m2 & ((UINT64_C(1) << e) - 1) : m2;
+
+            limbs[0] = static_cast<uint32_t>(fpart);
+            limbs[1] = static_cast<uint32_t>(fpart >> 32U);
+
+            const auto point_limb = static_cast<int>(e / 32U);
+            const auto point_bit  = e % 32U;
+
+            int low = 0;
+
+            while(pos < count)
+            {
+                // Lowest non zero limb (each multiplication adds 9 zero bits)
+                while(low <= point_limb && limbs[low] == 0) { ++low; }
+
+                if(low > point_limb)
+                {
+                    // No more fraction digits
+                    CharT* it = significand + pos;
+                    CharTraits::assign(it, '0', count - pos);
+                    return;
+                }
+
+                uint32_t chunk = multiply_1e9(limbs, low, point_limb, point_bit);
+
+                for(int i = pos + 8; i >= pos; --i)
+                {
+                    if(i >= 0 && i < count)
+                    {
+                        significand[i] = static_cast<CharT>('0' + chunk % 10);
+                    }
+                    else if(i >= count && chunk % 10 != 0)
+                    {
+                        exact = false;
+                    }
+
+                    chunk /= 10;
+                }
+
+                pos += 9;
+            }
+
+            // Digits left in the fraction
+            for(int i = low; i <= point_limb; ++i)
+            {
+                if(limbs[i] != 0) { exact = false; }
+            }
+        }
+
+        // Divides the integer `limbs` (`top` is the most significant one, updated)
+        // by 10^9 in place and returns the remainder.
+        static uint32_t divide_1e9(uint32_t* const limbs, int& top) noexcept
+        {
+            uint64_t r = 0;
+
+            for(int i = top; i >= 0; --i)
+            {
+                r = (r << 32U) | limbs[i];
+                limbs[i] = static_cast<uint32_t>(r / 1000000000U);
+                r %= 1000000000U;
+            }
+
+            while(top > 0 && limbs[top] == 0) { --top; }
+
+            return static_cast<uint32_t>(r);
+        }
+
+        // Multiplies the fraction `limbs` (binary point at the bit `point_bit`
+        // of the limb `point_limb`) by 10^9 in place. Returns the 9 digits
+        // above the binary point (removed from the fraction).
+        static uint32_t multiply_1e9(uint32_t* const limbs, const int low,
+                                     const int point_limb, const unsigned point_bit) noexcept
+        {
+            uint64_t carry = 0;
+
+            for(int i = low; i <= point_limb + 1; ++i)
+            {
+                carry += static_cast<uint64_t>(limbs[i]) * 1000000000U;
+                limbs[i] = static_cast<uint32_t>(carry);
+                carry >>= 32U;
+            }
+
+            const uint64_t top = (static_cast<uint64_t>(limbs[point_limb + 1]) << 32U) | limbs[point_limb];
+
+            limbs[point_limb    ] &= static_cast<uint32_t>((UINT64_C(1) << point_bit) - 1);
+            limbs[point_limb + 1]  = 0;
+
+            return static_cast<uint32_t>(top >> point_bit);
+        }
+
+#if defined(USF_FLOAT_EXTENDED_SUPPORT) || defined(USF_FLOAT_ENGINE_EXACT)
+        // -------- EXTENDED PRECISION CONVERSION -----------------------------
+        // The value (mantissa * 2^exponent, up to 113 mantissa bits) is split
+        // in its integer part, converted to 10^9 chunks by repeated division,
+        // and its fraction, converted by repeated multiplication by 10^9 (as
+        // the double exact conversion). The limbs cover the 16384 bits
+        // integers and the 16494 bits fractions of the 15 bit exponents.
+        // --------------------- ----------------------------------------------
+
+        static constexpr int kWideLimbs  = 520;
+        static constexpr int kWideChunks = 550; // 4933 digits
+
+        // Shortest conversion work buffers (the longest binary128 shortest
+        // representation has 36 digits).
+        static constexpr int kWideShortestDigits = 40;
+
+        static_assert(kSmallDigits >= kWideShortestDigits, "Float: the small conversion buffer is too small!");
+
+        struct WideFloat
+        {
+            uint64_t mantissa_high;
+            uint64_t mantissa_low;
+            int      exponent;      // value = mantissa * 2^exponent
+            int      ieee_exponent; // Biased exponent field
+            bool     fraction_zero; // All the stored fraction bits are zero
+            bool     negative;
+        };
+
+#if defined(USF_FLOAT_ENGINE_EXACT)
+        // The exact engine converts the double values as the extended ones.
+        static WideFloat decode(const double value) noexcept
+        {
+            const uint64_t bits = bit_cast(value);
+
+            const uint64_t ieee_mantissa = bits & ((UINT64_C(1) << 52U) - 1);
+            const auto     ieee_exponent = static_cast<int>((bits >> 52U) & 0x7FFU);
+
+            return WideFloat{0, (ieee_exponent == 0) ? ieee_mantissa : (UINT64_C(1) << 52U) | ieee_mantissa,
+                             ((ieee_exponent == 0) ? 1 : ieee_exponent) - 1023 - 52,
+                             ieee_exponent, ieee_mantissa == 0, (bits >> 63U) != 0};
+        }
+#endif
+
+#if defined(USF_LONG_DOUBLE_X87)
+        static WideFloat decode(const long double value) noexcept
+        {
+            // 64 bit mantissa (explicit integer bit) followed by the sign and the exponent
+            uint64_t mantissa = 0;
+            uint16_t sign_exponent = 0;
+
+            std::memcpy(&mantissa, &value, sizeof(mantissa));
+            std::memcpy(&sign_exponent, reinterpret_cast<const unsigned char*>(&value) + 8, sizeof(sign_exponent));
+
+            const int ieee_exponent = sign_exponent & 0x7FFF;
+
+            return WideFloat{0, mantissa, ((ieee_exponent == 0) ? 1 : ieee_exponent) - 16383 - 63,
+                             ieee_exponent, (mantissa << 1U) == 0, (sign_exponent >> 15U) != 0};
+        }
+#elif defined(USF_LONG_DOUBLE_BINARY128)
+        static WideFloat decode(const long double value) noexcept
+        {
+            return decode_binary128(&value);
+        }
+#endif
+
+#if defined(USF_FLOAT128_SUPPORT)
+        static WideFloat decode(const float128_t value) noexcept
+        {
+            return decode_binary128(&value);
+        }
+#endif
+
+        static WideFloat decode_binary128(const void* const value) noexcept
+        {
+            uint64_t words[2]{};
+
+            std::memcpy(words, value, sizeof(words));
+
+#if defined(USF_TARGET_LITTLE_ENDIAN)
+            const uint64_t high = words[1];
+            const uint64_t low  = words[0];
+#else
+            const uint64_t high = words[0];
+            const uint64_t low  = words[1];
+#endif
+            const auto     ieee_exponent = static_cast<int>((high >> 48U) & 0x7FFFU);
+            const uint64_t fraction_high = high & ((UINT64_C(1) << 48U) - 1);
+
+            return WideFloat{(ieee_exponent == 0) ? fraction_high : (UINT64_C(1) << 48U) | fraction_high, low,
+                             ((ieee_exponent == 0) ? 1 : ieee_exponent) - 16383 - 112,
+                             ieee_exponent, (fraction_high | low) == 0, (high >> 63U) != 0};
+        }
+
+        template <typename CharT> static
+        int convert_wide(CharT* const significand, int& exponent, const WideFloat& wide,
+                         const bool format_fixed, const int precision, const int max_digits) noexcept
+        {
+            bool exact = false;
+
+            const int digits_size = exact_digits_wide(significand, max_digits, exponent, exact,
+                                                      wide.mantissa_high, wide.mantissa_low, wide.exponent,
+                                                      format_fixed, precision);
+            if(digits_size == 0)
+            {
+                // Specified precision higher than converted value.
+                // Should print all zeros. Bail!
+                significand[0] = '0';
+                exponent = 0;
+                return 1;
+            }
+
+            const auto round_index = 1 + precision + (format_fixed ? exponent : 0);
+
+            // The digits up to the rounding one don't fit in the buffer
+            if(round_index >= max_digits && max_digits < kMaxDigits) { return 0; }
+
+            const auto significand_size = remove_trailing_zeros(significand, significand + digits_size);
+
+            if(significand_size <= round_index)
+            {
+                // Rounding not needed. Bail!
+                return significand_size;
+            }
+
+            //Round to the specified precision.
+            return round(significand, significand_size, exponent, format_fixed, round_index, exact);
+        }
+
+        // The digits of the rounding interval bounds and of the value are
+        // converted exactly, aligned to the upper bound exponent. For each
+        // length, the candidates are the values between the bounds (bounds
+        // included if the mantissa is even). The shortest one closest to the
+        // value is returned (ties to even).
+        template <typename CharT> static
+        int convert_shortest_wide(CharT* const significand, int& exponent, const WideFloat& wide) noexcept
+        {
+            constexpr int n_max = kWideShortestDigits;
+
+            // Value and interval bounds scaled by 4 (mv = 4m, mp = 4m + 2, mm = 4m - 1 or 4m - 2)
+            const uint64_t mv_high = (wide.mantissa_high << 2U) | (wide.mantissa_low >> 62U);
+            const uint64_t mv_low  =  wide.mantissa_low  << 2U;
+
+            const uint64_t mm_shift = (wide.fraction_zero && wide.ieee_exponent > 1) ? 1 : 2;
+            const uint64_t mm_high  = mv_high - static_cast<uint64_t>(mv_low < mm_shift);
+
+            char upper[n_max];
+            char value[n_max];
+            char lower[n_max];
+
+            bool upper_exact = false;
+            bool value_exact = false;
+            bool lower_exact = false;
+
+            int upper_exponent = 0;
+
+            exact_digits_wide(upper, n_max, upper_exponent, upper_exact, mv_high, mv_low + 2,
+                              wide.exponent - 2, false, n_max - 2);
+
+            // Same last digit position as the upper bound
+            const int fixed_precision = n_max - 2 - upper_exponent;
+
+            exact_digits_wide_aligned(value, value_exact, mv_high, mv_low, wide.exponent - 2, fixed_precision);
+            exact_digits_wide_aligned(lower, lower_exact, mm_high, mv_low - mm_shift, wide.exponent - 2, fixed_precision);
+
+            const bool accept_bounds = (wide.mantissa_low & 1U) == 0;
+
+            for(int n = 1; n < n_max - 1; ++n)
+            {
+                char low[n_max];
+                char high[n_max];
+                char closest[n_max];
+
+                std::memcpy(low,     lower, static_cast<std::size_t>(n));
+                std::memcpy(high,    upper, static_cast<std::size_t>(n));
+                std::memcpy(closest, value, static_cast<std::size_t>(n));
+
+                // Lowest and highest candidates (no candidates if out of n digits)
+                if(!accept_bounds || digits_follow(lower, n, lower_exact))
+                {
+                    if(!increment_digits(low, n)) { continue; }
+                }
+
+                if(!accept_bounds && !digits_follow(upper, n, upper_exact))
+                {
+                    if(!decrement_digits(high, n)) { continue; }
+                }
+
+                if(std::memcmp(low, high, static_cast<std::size_t>(n)) > 0) { continue; }
+
+                // Value rounded to n digits, limited to the candidates range
+                const bool round_up = value[n] > '5'
+                                   || (value[n] == '5' && (digits_follow(value, n + 1, value_exact) || ((value[n - 1] - '0') & 1) != 0));
+
+                if(round_up && !increment_digits(closest, n))
+                {
+                    std::memcpy(closest, high, static_cast<std::size_t>(n));
+                }
+
+                if(std::memcmp(closest, low, static_cast<std::size_t>(n)) < 0)
+                {
+                    std::memcpy(closest, low, static_cast<std::size_t>(n));
+                }
+                else if(std::memcmp(closest, high, static_cast<std::size_t>(n)) > 0)
+                {
+                    std::memcpy(closest, high, static_cast<std::size_t>(n));
+                }
+
+                int leading_zeros = 0;
+
+                while(leading_zeros < n - 1 && closest[leading_zeros] == '0') { ++leading_zeros; }
+
+                exponent = upper_exponent - leading_zeros;
+
+                CharT* it = significand;
+                CharTraits::copy(it, closest + leading_zeros, n - leading_zeros);
+
+                return remove_trailing_zeros(significand, it);
+            }
+
+            // Not reachable (the last lengths are always finer than the interval)
+            assert(false);
+            significand[0] = '0';
+            exponent = 0;
+            return 1;
+        }
+
+        // Exact digits of the value aligned to the last digit position given
+        // by the fixed `precision`, padded with leading zeros up to
+        // `kWideShortestDigits` digits.
+        static void exact_digits_wide_aligned(char* const digits, bool& exact, const uint64_t mantissa_high,
+                                              const uint64_t mantissa_low, const int e2, const int precision) noexcept
+        {
+            constexpr int n_max = kWideShortestDigits;
+
+            int exponent = 0;
+
+            const int count = exact_digits_wide(digits, n_max, exponent, exact, mantissa_high, mantissa_low, e2, true, precision);
+
+            std::memmove(digits + n_max - count, digits, static_cast<std::size_t>(count));
+            std::memset(digits, '0', static_cast<std::size_t>(n_max - count));
+        }
+
+        // True if there are non-zero digits from the position `index`.
+        static bool digits_follow(const char* const digits, const int index, const bool exact) noexcept
+        {
+            for(int i = index; i < kWideShortestDigits; ++i)
+            {
+                if(digits[i] != '0') { return true; }
+            }
+
+            return !exact;
+        }
+
+        // Increments/decrements the n digits number. Returns false on overflow.
+        static bool increment_digits(char* const digits, const int n) noexcept
+        {
+            for(int i = n - 1; i >= 0; --i)
+            {
+                if(digits[i] != '9') { ++digits[i]; return true; }
+                digits[i] = '0';
+            }
+
+            return false;
+        }
+
+        static bool decrement_digits(char* const digits, const int n) noexcept
+        {
+            for(int i = n - 1; i >= 0; --i)
+            {
+                if(digits[i] != '0') { --digits[i]; return true; }
+                digits[i] = '9';
+            }
+
+            return false;
+        }
+
+        // Writes the first `max_count` digits (or up to the rounding digit
+        // for the `format_fixed` and `precision`, as the convert() function)
+        // of mantissa * 2^e2. Returns the number of digits written (0 if the
+        // rounding digit is before the first digit) and sets the exponent
+        // and the `exact` flag (no other non-zero digits follow).
+        template <typename CharT> static
+        int exact_digits_wide(CharT* const significand, const int max_count, int& exponent, bool& exact,
+                              const uint64_t mantissa_high, const uint64_t mantissa_low, const int e2,
+                              const bool format_fixed, const int precision) noexcept
+        {
+            const uint32_t mantissa[4]
+            {
+                static_cast<uint32_t>(mantissa_low ), static_cast<uint32_t>(mantissa_low  >> 32U),
+                static_cast<uint32_t>(mantissa_high), static_cast<uint32_t>(mantissa_high >> 32U)
+            };
+
+            uint32_t limbs[kWideLimbs];   // Not initialized (only the used limbs are set)
+            uint32_t chunks[kWideChunks]; // Not initialized
+
+            // Integer part (10^9 chunks, least significant first)
+            int chunk_count = 0;
+            {
+                uint32_t ipart[4];
+                uint32_t* ilimbs = ipart;
+                int top = 3;
+
+                if(e2 >= 0)
+                {
+                    const int      word = e2 / 32;
+                    const auto     bit  = static_cast<unsigned>(e2 % 32);
+
+                    for(int i = 0; i < word; ++i) { limbs[i] = 0; }
+
+                    for(int i = 0; i <= 4; ++i)
+                    {
+                        const uint32_t current  = (i < 4) ? mantissa[i] << bit : 0;
+                        const uint32_t previous = (i > 0 && bit != 0) ? mantissa[i - 1] >> (32U - bit) : 0;
+
+                        limbs[word + i] = current | previous;
+                    }
+
+                    ilimbs = limbs;
+                    top = word + 4;
+                }
+                else
+                {
+                    const int  word = -e2 / 32;
+                    const auto bit  = static_cast<unsigned>(-e2 % 32);
+
+                    for(int i = 0; i < 4; ++i)
+                    {
+                        const uint32_t current = (i + word < 4) ? mantissa[i + word] >> bit : 0;
+                        const uint32_t next    = (i + word + 1 < 4 && bit != 0) ? mantissa[i + word + 1] << (32U - bit) : 0;
+
+                        ipart[i] = current | next;
+                    }
+                }
+
+                while(top > 0 && ilimbs[top] == 0) { --top; }
+
+                while(top > 0 || ilimbs[0] != 0)
+                {
+                    chunks[chunk_count++] = divide_1e9(ilimbs, top);
+                }
+            }
+
+            // Fraction (the binary point is at the bit `point_bit` of the limb `point_limb`)
+            const int  point      = (e2 < 0) ? -e2 : 0;
+            const int  point_limb = point / 32;
+            const auto point_bit  = static_cast<unsigned>(point % 32);
+
+            int low  = 0;
+            int high = -1;
+
+            if(e2 < 0)
+            {
+                for(int i = 0; i < 4 && i <= point_limb; ++i) { limbs[high = i] = mantissa[i]; }
+
+                if(point_limb < 4) { limbs[point_limb] &= (UINT32_C(1) << point_bit) - 1; }
+
+                trim_limbs(limbs, low, high);
+            }
+
+            exact = true;
+
+            int count = 0;
+            int pos = 0;
+
+            if(chunk_count > 0)
+            {
+                const int digits = Integer::count_digits_dec(chunks[chunk_count - 1]);
+
+                exponent = 9 * (chunk_count - 1) + digits - 1;
+                count = wide_digits_count(max_count, exponent, format_fixed, precision);
+
+                write_chunk(significand, pos, digits, chunks[chunk_count - 1], count, exact);
+
+                for(int i = chunk_count - 2; i >= 0 && (pos < count || exact); --i)
+                {
+                    write_chunk(significand, pos, 9, chunks[i], count, exact);
+                }
+            }
+            else
+            {
+                // Skip the fraction leading zeros
+                for(int zeros = 0; ; zeros += 9)
+                {
+                    const uint32_t chunk = multiply_1e9_wide(limbs, low, high, point_limb, point_bit);
+
+                    if(chunk != 0)
+                    {
+                        const int digits = Integer::count_digits_dec(chunk);
+
+                        exponent = -(zeros + 9 - digits) - 1;
+                        count = wide_digits_count(max_count, exponent, format_fixed, precision);
+
+                        if(count == 0) { return 0; }
+
+                        write_chunk(significand, pos, digits, chunk, count, exact);
+                        break;
+                    }
+
+                    // The rounding digit is before the first digit
+                    if(format_fixed && zeros + 9 > precision) { return 0; }
+                }
+            }
+
+            // Fraction digits
+            while(low <= high && pos < count)
+            {
+                write_chunk(significand, pos, 9, multiply_1e9_wide(limbs, low, high, point_limb, point_bit), count, exact);
+            }
+
+            if(low <= high) { exact = false; }
+
+            if(pos < count)
+            {
+                CharT* it = significand + pos;
+                CharTraits::assign(it, '0', count - pos);
+            }
+
+            return count;
+        }
+
+        // Number of digits to convert: up to the rounding digit (as the
+        // convert() function), 0 if it is before the first digit.
+        static int wide_digits_count(const int max_count, const int exponent,
+                                     const bool format_fixed, const int precision) noexcept
+        {
+            const int round_index = 1 + precision + (format_fixed ? exponent : 0);
+
+            if(round_index < 0) { return 0; }
+
+            return (round_index < max_count) ? round_index + 1 : max_count;
+        }
+
+        // Writes the `digits` last digits of the chunk at the position `pos`
+        // (advanced). The non-zero digits after `count` clear the `exact` flag.
+        template <typename CharT> static
+        void write_chunk(CharT* const significand, int& pos, const int digits, uint32_t chunk,
+                         const int count, bool& exact) noexcept
+        {
+            for(int i = pos + digits - 1; i >= pos; --i)
+            {
+                const uint32_t digit = chunk % 10;
+
+                if(i < count) { significand[i] = static_cast<CharT>('0' + digit); }
+                else if(digit != 0) { exact = false; }
+
+                chunk /= 10;
+            }
+
+            pos += digits;
+        }
+
+        // Multiplies the fraction limbs [low, high] by 10^9 in place. Returns
+        // the 9 digits above the binary point (removed from the fraction).
+        static uint32_t multiply_1e9_wide(uint32_t* const limbs, int& low, int& high,
+                                          const int point_limb, const unsigned point_bit) noexcept
+        {
+            uint64_t carry = 0;
+
+            for(int i = low; i <= high; ++i)
+            {
+                carry += static_cast<uint64_t>(limbs[i]) * 1000000000U;
+                limbs[i] = static_cast<uint32_t>(carry);
+                carry >>= 32U;
+            }
+
+            if(carry != 0) { limbs[++high] = static_cast<uint32_t>(carry); }
+
+            uint32_t digits = 0;
+
+            if(high >= point_limb)
+            {
+                const uint64_t top = ((high > point_limb) ? static_cast<uint64_t>(limbs[point_limb + 1]) << 32U : 0)
+                                   | limbs[point_limb];
+
+                digits = static_cast<uint32_t>(top >> point_bit);
+
+                limbs[point_limb] &= static_cast<uint32_t>((UINT64_C(1) << point_bit) - 1);
+                high = point_limb;
+            }
+
+            trim_limbs(limbs, low, high);
+
+            return digits;
+        }
+
+        // Removes the zero limbs from both ends of the range [low, high]
+        static void trim_limbs(const uint32_t* const limbs, int& low, int& high) noexcept
+        {
+            while(high >= low && limbs[high] == 0) { --high; }
+            while(low <= high && limbs[low ] == 0) { ++low;  }
+        }
+#endif // defined(USF_FLOAT_EXTENDED_SUPPORT) || defined(USF_FLOAT_ENGINE_EXACT)
+
+        // -------- SCALED ROUNDING HELPERS -----------------------------------
+
+        // Rounding error of `product` = `a` * `b` (exact). Uses a fused multiply
+        // add when fast, otherwise Dekker's product (26 bit halves).
+        static double product_error(const double a, const double b, const double product) noexcept
+        {
+#if defined(FP_FAST_FMA)
+            return std::fma(a, b, -product);
+#else
+            const double a_split = a * 134217729.0; // 2^27 + 1
+            const double b_split = b * 134217729.0;
+
+            const double a_high = a_split - (a_split - a);
+            const double b_high = b_split - (b_split - b);
+            const double a_low  = a - a_high;
+            const double b_low  = b - b_high;
+
+            return (((a_high * b_high - product) + a_high * b_low) + a_low * b_high) + a_low * b_low;
+#endif
+        }
+
+#if defined(USF_SIMD_SSE2)
+        static int round_scaled_sse2(uint64_t* const scaled, const __m128d values, const int precision) noexcept
+        {
+            assert(precision >= 0 && precision < 10);
+
+            const __m128d magic    = _mm_set1_pd(4503599627370496.0); // 2^52
+            const __m128d sign     = _mm_set1_pd(-0.0);
+            const __m128d scale    = _mm_set1_pd(static_cast<double>(Integer::pow10_uint32(precision)));
+
+            const __m128d product  = _mm_mul_pd(_mm_andnot_pd(sign, values), scale);
+
+            // Adding 2^52 rounds the product to an integer (to nearest, ties
+            // to even) placed in the low bits of the sum.
+            const __m128d sum      = _mm_add_pd(product, magic);
+            const __m128d rounded  = _mm_sub_pd(sum, magic);
+
+            const __m128d in_range = _mm_cmplt_pd(product, magic);
+            const __m128d halfway  = _mm_cmpeq_pd(_mm_andnot_pd(sign, _mm_sub_pd(rounded, product)), _mm_set1_pd(0.5));
+
+            const __m128i integers = _mm_sub_epi64(_mm_castpd_si128(sum), _mm_castpd_si128(magic));
+            std::memcpy(scaled, &integers, sizeof(integers));
+
+            return _mm_movemask_pd(_mm_andnot_pd(halfway, in_range));
+        }
+#endif
+
+#if defined(USF_FLOAT_ENGINE_FAST)
+        // 5^-i and 5^i multipliers: rows of the full tables (the buffer is
+        // not used).
+        static USF_CPP14_CONSTEXPR const uint64_t* pow5_inv_split(const int i, uint64_t* const) noexcept
+        {
+            return ryu_pow5_inv_split_lut[i];
+        }
+
+        static USF_CPP14_CONSTEXPR const uint64_t* pow5_split(const int i, uint64_t* const) noexcept
+        {
+            return ryu_pow5_split_lut[i];
+        }
+#elif defined(USF_FLOAT_ENGINE_COMPACT)
+        // 5^-i and 5^i multipliers computed in the buffer: the nearest base
+        // entry (5^-base2 above or 5^base2 below) times 5^(base2 - i) or
+        // 5^(i - base2), renormalized to 125 bits and corrected by the offset.
+        static USF_CPP14_CONSTEXPR const uint64_t* pow5_inv_split(const int i, uint64_t* const result) noexcept
+        {
+            const int base = (i + 25) / 26;
+            const int base2 = base * 26;
+
+            const uint64_t* const mul = ryu_pow5_inv_split_base_lut[base];
+
+            if(base2 == i) { return mul; }
+
+            const uint64_t m = ryu_pow5_lut[base2 - i];
+
+            uint64_t high0 = 0;
+            uint64_t high1 = 0;
+
+            const uint64_t low0 = umul128(m, mul[0] - 1, high0);
+            const uint64_t low1 = umul128(m, mul[1], high1);
+
+            const uint64_t sum = high0 + low1;
+
+            if(sum < high0) { ++high1; }
+
+            const auto dist = static_cast<unsigned>(pow5_bits(base2) - pow5_bits(i));
+            const auto offset = static_cast<unsigned>(i % 16) * 2U;
+
+            result[0] = shift_right128(low0, sum, dist) + 1 + ((ryu_pow5_inv_offsets_lut[i / 16] >> offset) & 3U);
+            result[1] = shift_right128(sum, high1, dist);
+
+            return result;
+        }
+
+        static USF_CPP14_CONSTEXPR const uint64_t* pow5_split(const int i, uint64_t* const result) noexcept
+        {
+            const int base = i / 26;
+            const int base2 = base * 26;
+
+            const uint64_t* const mul = ryu_pow5_split_base_lut[base];
+
+            if(base2 == i) { return mul; }
+
+            const uint64_t m = ryu_pow5_lut[i - base2];
+
+            uint64_t high0 = 0;
+            uint64_t high1 = 0;
+
+            const uint64_t low0 = umul128(m, mul[0], high0);
+            const uint64_t low1 = umul128(m, mul[1], high1);
+
+            const uint64_t sum = high0 + low1;
+
+            if(sum < high0) { ++high1; }
+
+            const auto dist = static_cast<unsigned>(pow5_bits(i) - pow5_bits(base2));
+            const auto offset = static_cast<unsigned>(i % 16) * 2U;
+
+            result[0] = shift_right128(low0, sum, dist) + ((ryu_pow5_offsets_lut[i / 16] >> offset) & 3U);
+            result[1] = shift_right128(sum, high1, dist);
+
+            return result;
+        }
+
+        // Low word of (high:low) >> dist, for dist in [1, 63]
+        static constexpr uint64_t shift_right128(const uint64_t low, const uint64_t high, const unsigned dist) noexcept
+        {
+            return (high << (64U - dist)) | (low >> dist);
+        }
+#endif
+
+        // Computes (4 * m2 + {2, 0, -1 - mm_shift}) * mul >> j (the interval bounds).
+        static USF_CPP14_CONSTEXPR uint64_t mul_shift(const uint64_t mv, const uint32_t mm_shift, const uint64_t* mul,
+                                                      const int j, uint64_t& vp, uint64_t& vm) noexcept
+        {
+            vp = mul_shift(mv + 2, mul, j);
+            vm = mul_shift(mv - 1 - mm_shift, mul, j);
+
+            return mul_shift(mv, mul, j);
+        }
+
+        static USF_CPP14_CONSTEXPR uint64_t mul_shift(const uint64_t m, const uint64_t* mul, const int j) noexcept
+        {
+            assert(j > 64 && j < 128);
+
+            uint64_t high0 = 0;
+            uint64_t high1 = 0;
+
+            umul128(m, mul[0], high0);
+            const uint64_t low1 = umul128(m, mul[1], high1);
+
+            const uint64_t sum = high0 + low1;
+
+            if(sum < high0) { ++high1; }
+
+            const auto dist = static_cast<unsigned>(j - 64);
+
+            return (high1 << (64U - dist)) | (sum >> dist);
+        }
+
+        // 64 x 64 bit multiplication. Returns the low word of the result.
+        static USF_CPP14_CONSTEXPR uint64_t umul128(const uint64_t a, const uint64_t b, uint64_t& high) noexcept
+        {
+#if defined(USF_INT128_SUPPORT)
+            const uint128_t p = static_cast<uint128_t>(a) * b;
+
+            high = static_cast<uint64_t>(p >> 64U);
+
+            return static_cast<uint64_t>(p);
+#else
+            const uint64_t a_lo = a & 0xFFFFFFFFU;
+            const uint64_t a_hi = a >> 32U;
+            const uint64_t b_lo = b & 0xFFFFFFFFU;
+            const uint64_t b_hi = b >> 32U;
+
+            const uint64_t b00 = a_lo * b_lo;
+            const uint64_t b01 = a_lo * b_hi;
+            const uint64_t b10 = a_hi * b_lo;
+            const uint64_t b11 = a_hi * b_hi;
+
+            const uint64_t mid1 = b10 + (b00 >> 32U);
+            const uint64_t mid2 = b01 + (mid1 & 0xFFFFFFFFU);
+
+            high = b11 + (mid1 >> 32U) + (mid2 >> 32U);
+
+            return (mid2 << 32U) | (b00 & 0xFFFFFFFFU);
+#endif
+        }
+
+        static USF_CPP14_CONSTEXPR bool multiple_of_pow5(uint64_t value, const int p) noexcept
+        {
+            int count = 0;
+
+            for(; value % 5 == 0 && count < p; ++count) { value /= 5; }
+
+            return count >= p;
+        }
+
+        // ceil(log2(5^e)) for e in [0, 3528] (1 for e == 0)
+        static constexpr int pow5_bits(const int e) noexcept
+        {
+            return static_cast<int>((static_cast<uint32_t>(e) * 1217359U) >> 19U) + 1;
+        }
+
+        // floor(log10(2^e)) for e in [0, 1650]
+        static constexpr int log10_pow2(const int e) noexcept
+        {
+            return static_cast<int>((static_cast<uint32_t>(e) * 78913U) >> 18U);
+        }
+
+        // floor(log10(5^e)) for e in [0, 2620]
+        static constexpr int log10_pow5(const int e) noexcept
+        {
+            return static_cast<int>((static_cast<uint32_t>(e) * 732923U) >> 20U);
+        }
+
+        static uint64_t bit_cast(const double value) noexcept
+        {
+            uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        static uint32_t bit_cast(const float value) noexcept
+        {
+            uint32_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
         template <typename CharT> static USF_CPP14_CONSTEXPR
         int round(CharT* const significand, const int significand_size, int& exponent,
-                  const bool format_fixed, const int round_index) noexcept
+                  const bool format_fixed, const int round_index, const bool exact) noexcept
         {
             CharT* it = significand + round_index;
 
             bool round_up = false;
 
-            if(round_index == significand_size - 1)
+            if(round_index == significand_size - 1 && exact)
             {
-                // Round the last digit of the significand buffer.
+                // Round the last digit of the significand buffer (when
+                // no other digits follow it in the converted value).
                 // It can simultaneously be the first one if the
                 // significant buffer has only one digit.
 
@@ -148,8 +2368,9 @@ class Float
             else if(*it >= '5')
             {
                 // Round any digit except the last one. Since the trailing zeros were
-                // removed, we only need to test if the digit is at least '5' because it
-                // is granted that other non-zero digits are present after this position.
+                // removed (or the value is not exact), we only need to test if the digit
+                // is at least '5' because it is granted that other non-zero digits are
+                // present after this position.
                 round_up = true;
             }
 
@@ -217,6 +2438,7 @@ class Float
         }
 };
 
+} // inline namespace USF_ENGINE_NAMESPACE
 } // namespace internal
 } // namespace usf
 
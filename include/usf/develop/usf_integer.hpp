@@ -50,8 +50,175 @@ constexpr uint64_t pow10_uint64_lut[]
     10000000000000000000U
 };
 
-constexpr char digits_hex_uppercase[]{"0123456789ABCDEF"};
-constexpr char digits_hex_lowercase[]{"0123456789abcdef"};
+// Fused digit count lookup table for 32 bit values, indexed by the position
+// of the most significant bit `i`. Each entry holds `(k << 32) + 2^32 - 10^k`
+// (or only `k << 32` if 10^k doesn't fit in 32 bits) where `k` is the number
+// of digits of 2^i. Adding a value to its entry carries into the upper half
+// exactly when the value has `k + 1` digits.
+constexpr uint64_t count_digits_dec_lut[]
+{
+     8589934582U,  8589934582U,  8589934582U,  8589934582U,
+    12884901788U, 12884901788U, 12884901788U, 17179868184U,
+    17179868184U, 17179868184U, 21474826480U, 21474826480U,
+    21474826480U, 21474826480U, 25769703776U, 25769703776U,
+    25769703776U, 30063771072U, 30063771072U, 30063771072U,
+    34349738368U, 34349738368U, 34349738368U, 34349738368U,
+    38554705664U, 38554705664U, 38554705664U, 41949672960U,
+    41949672960U, 41949672960U, 42949672960U, 42949672960U
+};
+
+constexpr char digits_dec_pairs[]
+{
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899"
+};
+
+#if !defined(USF_DISABLE_SMALL_INTEGER_LUT)
+// Ready-made decimal digits of the values [0, 999]. The digits are packed
+// from the least significant byte (first digit) and the number of digits
+// is in the most significant byte, e.g. 42 -> 0x02003234.
+constexpr uint32_t small_dec_lut[]
+{
+    0x01000030U, 0x01000031U, 0x01000032U, 0x01000033U, 0x01000034U, 0x01000035U, 0x01000036U, 0x01000037U,
+    0x01000038U, 0x01000039U, 0x02003031U, 0x02003131U, 0x02003231U, 0x02003331U, 0x02003431U, 0x02003531U,
+    0x02003631U, 0x02003731U, 0x02003831U, 0x02003931U, 0x02003032U, 0x02003132U, 0x02003232U, 0x02003332U,
+    0x02003432U, 0x02003532U, 0x02003632U, 0x02003732U, 0x02003832U, 0x02003932U, 0x02003033U, 0x02003133U,
+    0x02003233U, 0x02003333U, 0x02003433U, 0x02003533U, 0x02003633U, 0x02003733U, 0x02003833U, 0x02003933U,
+    0x02003034U, 0x02003134U, 0x02003234U, 0x02003334U, 0x02003434U, 0x02003534U, 0x02003634U, 0x02003734U,
+    0x02003834U, 0x02003934U, 0x02003035U, 0x02003135U, 0x02003235U, 0x02003335U, 0x02003435U, 0x02003535U,
+    0x02003635U, 0x02003735U, 0x02003835U, 0x02003935U, 0x02003036U, 0x02003136U, 0x02003236U, 0x02003336U,
+    0x02003436U, 0x02003536U, 0x02003636U, 0x02003736U, 0x02003836U, 0x02003936U, 0x02003037U, 0x02003137U,
+    0x02003237U, 0x02003337U, 0x02003437U, 0x02003537U, 0x02003637U, 0x02003737U, 0x02003837U, 0x02003937U,
+    0x02003038U, 0x02003138U, 0x02003238U, 0x02003338U, 0x02003438U, 0x02003538U, 0x02003638U, 0x02003738U,
+    0x02003838U, 0x02003938U, 0x02003039U, 0x02003139U, 0x02003239U, 0x02003339U, 0x02003439U, 0x02003539U,
+    0x02003639U, 0x02003739U, 0x02003839U, 0x02003939U, 0x03303031U, 0x03313031U, 0x03323031U, 0x03333031U,
+    0x03343031U, 0x03353031U, 0x03363031U, 0x03373031U, 0x03383031U, 0x03393031U, 0x03303131U, 0x03313131U,
+    0x03323131U, 0x03333131U, 0x03343131U, 0x03353131U, 0x03363131U, 0x03373131U, 0x03383131U, 0x03393131U,
+    0x03303231U, 0x03313231U, 0x03323231U, 0x03333231U, 0x03343231U, 0x03353231U, 0x03363231U, 0x03373231U,
+    0x03383231U, 0x03393231U, 0x03303331U, 0x03313331U, 0x03323331U, 0x03333331U, 0x03343331U, 0x03353331U,
+    0x03363331U, 0x03373331U, 0x03383331U, 0x03393331U, 0x03303431U, 0x03313431U, 0x03323431U, 0x03333431U,
+    0x03343431U, 0x03353431U, 0x03363431U, 0x03373431U, 0x03383431U, 0x03393431U, 0x03303531U, 0x03313531U,
+    0x03323531U, 0x03333531U, 0x03343531U, 0x03353531U, 0x03363531U, 0x03373531U, 0x03383531U, 0x03393531U,
+    0x03303631U, 0x03313631U, 0x03323631U, 0x03333631U, 0x03343631U, 0x03353631U, 0x03363631U, 0x03373631U,
+    0x03383631U, 0x03393631U, 0x03303731U, 0x03313731U, 0x03323731U, 0x03333731U, 0x03343731U, 0x03353731U,
+    0x03363731U, 0x03373731U, 0x03383731U, 0x03393731U, 0x03303831U, 0x03313831U, 0x03323831U, 0x03333831U,
+    0x03343831U, 0x03353831U, 0x03363831U, 0x03373831U, 0x03383831U, 0x03393831U, 0x03303931U, 0x03313931U,
+    0x03323931U, 0x03333931U, 0x03343931U, 0x03353931U, 0x03363931U, 0x03373931U, 0x03383931U, 0x03393931U,
+    0x03303032U, 0x03313032U, 0x03323032U, 0x03333032U, 0x03343032U, 0x03353032U, 0x03363032U, 0x03373032U,
+    0x03383032U, 0x03393032U, 0x03303132U, 0x03313132U, 0x03323132U, 0x03333132U, 0x03343132U, 0x03353132U,
+    0x03363132U, 0x03373132U, 0x03383132U, 0x03393132U, 0x03303232U, 0x03313232U, 0x03323232U, 0x03333232U,
+    0x03343232U, 0x03353232U, 0x03363232U, 0x03373232U, 0x03383232U, 0x03393232U, 0x03303332U, 0x03313332U,
+    0x03323332U, 0x03333332U, 0x03343332U, 0x03353332U, 0x03363332U, 0x03373332U, 0x03383332U, 0x03393332U,
+    0x03303432U, 0x03313432U, 0x03323432U, 0x03333432U, 0x03343432U, 0x03353432U, 0x03363432U, 0x03373432U,
+    0x03383432U, 0x03393432U, 0x03303532U, 0x03313532U, 0x03323532U, 0x03333532U, 0x03343532U, 0x03353532U,
+    0x03363532U, 0x03373532U, 0x03383532U, 0x03393532U, 0x03303632U, 0x03313632U, 0x03323632U, 0x03333632U,
+    0x03343632U, 0x03353632U, 0x03363632U, 0x03373632U, 0x03383632U, 0x03393632U, 0x03303732U, 0x03313732U,
+    0x03323732U, 0x03333732U, 0x03343732U, 0x03353732U, 0x03363732U, 0x03373732U, 0x03383732U, 0x03393732U,
+    0x03303832U, 0x03313832U, 0x03323832U, 0x03333832U, 0x03343832U, 0x03353832U, 0x03363832U, 0x03373832U,
+    0x03383832U, 0x03393832U, 0x03303932U, 0x03313932U, 0x03323932U, 0x03333932U, 0x03343932U, 0x03353932U,
+    0x03363932U, 0x03373932U, 0x03383932U, 0x03393932U, 0x03303033U, 0x03313033U, 0x03323033U, 0x03333033U,
+    0x03343033U, 0x03353033U, 0x03363033U, 0x03373033U, 0x03383033U, 0x03393033U, 0x03303133U, 0x03313133U,
+    0x03323133U, 0x03333133U, 0x03343133U, 0x03353133U, 0x03363133U, 0x03373133U, 0x03383133U, 0x03393133U,
+    0x03303233U, 0x03313233U, 0x03323233U, 0x03333233U, 0x03343233U, 0x03353233U, 0x03363233U, 0x03373233U,
+    0x03383233U, 0x03393233U, 0x03303333U, 0x03313333U, 0x03323333U, 0x03333333U, 0x03343333U, 0x03353333U,
+    0x03363333U, 0x03373333U, 0x03383333U, 0x03393333U, 0x03303433U, 0x03313433U, 0x03323433U, 0x03333433U,
+    0x03343433U, 0x03353433U, 0x03363433U, 0x03373433U, 0x03383433U, 0x03393433U, 0x03303533U, 0x03313533U,
+    0x03323533U, 0x03333533U, 0x03343533U, 0x03353533U, 0x03363533U, 0x03373533U, 0x03383533U, 0x03393533U,
+    0x03303633U, 0x03313633U, 0x03323633U, 0x03333633U, 0x03343633U, 0x03353633U, 0x03363633U, 0x03373633U,
+    0x03383633U, 0x03393633U, 0x03303733U, 0x03313733U, 0x03323733U, 0x03333733U, 0x03343733U, 0x03353733U,
+    0x03363733U, 0x03373733U, 0x03383733U, 0x03393733U, 0x03303833U, 0x03313833U, 0x03323833U, 0x03333833U,
+    0x03343833U, 0x03353833U, 0x03363833U, 0x03373833U, 0x03383833U, 0x03393833U, 0x03303933U, 0x03313933U,
+    0x03323933U, 0x03333933U, 0x03343933U, 0x03353933U, 0x03363933U, 0x03373933U, 0x03383933U, 0x03393933U,
+    0x03303034U, 0x03313034U, 0x03323034U, 0x03333034U, 0x03343034U, 0x03353034U, 0x03363034U, 0x03373034U,
+    0x03383034U, 0x03393034U, 0x03303134U, 0x03313134U, 0x03323134U, 0x03333134U, 0x03343134U, 0x03353134U,
+    0x03363134U, 0x03373134U, 0x03383134U, 0x03393134U, 0x03303234U, 0x03313234U, 0x03323234U, 0x03333234U,
+    0x03343234U, 0x03353234U, 0x03363234U, 0x03373234U, 0x03383234U, 0x03393234U, 0x03303334U, 0x03313334U,
+    0x03323334U, 0x03333334U, 0x03343334U, 0x03353334U, 0x03363334U, 0x03373334U, 0x03383334U, 0x03393334U,
+    0x03303434U, 0x03313434U, 0x03323434U, 0x03333434U, 0x03343434U, 0x03353434U, 0x03363434U, 0x03373434U,
+    0x03383434U, 0x03393434U, 0x03303534U, 0x03313534U, 0x03323534U, 0x03333534U, 0x03343534U, 0x03353534U,
+    0x03363534U, 0x03373534U, 0x03383534U, 0x03393534U, 0x03303634U, 0x03313634U, 0x03323634U, 0x03333634U,
+    0x03343634U, 0x03353634U, 0x03363634U, 0x03373634U, 0x03383634U, 0x03393634U, 0x03303734U, 0x03313734U,
+    0x03323734U, 0x03333734U, 0x03343734U, 0x03353734U, 0x03363734U, 0x03373734U, 0x03383734U, 0x03393734U,
+    0x03303834U, 0x03313834U, 0x03323834U, 0x03333834U, 0x03343834U, 0x03353834U, 0x03363834U, 0x03373834U,
+    0x03383834U, 0x03393834U, 0x03303934U, 0x03313934U, 0x03323934U, 0x03333934U, 0x03343934U, 0x03353934U,
+    0x03363934U, 0x03373934U, 0x03383934U, 0x03393934U, 0x03303035U, 0x03313035U, 0x03323035U, 0x03333035U,
+    0x03343035U, 0x03353035U, 0x03363035U, 0x03373035U, 0x03383035U, 0x03393035U, 0x03303135U, 0x03313135U,
+    0x03323135U, 0x03333135U, 0x03343135U, 0x03353135U, 0x03363135U, 0x03373135U, 0x03383135U, 0x03393135U,
+    0x03303235U, 0x03313235U, 0x03323235U, 0x03333235U, 0x03343235U, 0x03353235U, 0x03363235U, 0x03373235U,
+    0x03383235U, 0x03393235U, 0x03303335U, 0x03313335U, 0x03323335U, 0x03333335U, 0x03343335U, 0x03353335U,
+    0x03363335U, 0x03373335U, 0x03383335U, 0x03393335U, 0x03303435U, 0x03313435U, 0x03323435U, 0x03333435U,
+    0x03343435U, 0x03353435U, 0x03363435U, 0x03373435U, 0x03383435U, 0x03393435U, 0x03303535U, 0x03313535U,
+    0x03323535U, 0x03333535U, 0x03343535U, 0x03353535U, 0x03363535U, 0x03373535U, 0x03383535U, 0x03393535U,
+    0x03303635U, 0x03313635U, 0x03323635U, 0x03333635U, 0x03343635U, 0x03353635U, 0x03363635U, 0x03373635U,
+    0x03383635U, 0x03393635U, 0x03303735U, 0x03313735U, 0x03323735U, 0x03333735U, 0x03343735U, 0x03353735U,
+    0x03363735U, 0x03373735U, 0x03383735U, 0x03393735U, 0x03303835U, 0x03313835U, 0x03323835U, 0x03333835U,
+    0x03343835U, 0x03353835U, 0x03363835U, 0x03373835U, 0x03383835U, 0x03393835U, 0x03303935U, 0x03313935U,
+    0x03323935U, 0x03333935U, 0x03343935U, 0x03353935U, 0x03363935U, 0x03373935U, 0x03383935U, 0x03393935U,
+    0x03303036U, 0x03313036U, 0x03323036U, 0x03333036U, 0x03343036U, 0x03353036U, 0x03363036U, 0x03373036U,
+    0x03383036U, 0x03393036U, 0x03303136U, 0x03313136U, 0x03323136U, 0x03333136U, 0x03343136U, 0x03353136U,
+    0x03363136U, 0x03373136U, 0x03383136U, 0x03393136U, 0x03303236U, 0x03313236U, 0x03323236U, 0x03333236U,
+    0x03343236U, 0x03353236U, 0x03363236U, 0x03373236U, 0x03383236U, 0x03393236U, 0x03303336U, 0x03313336U,
+    0x03323336U, 0x03333336U, 0x03343336U, 0x03353336U, 0x03363336U, 0x03373336U, 0x03383336U, 0x03393336U,
+    0x03303436U, 0x03313436U, 0x03323436U, 0x03333436U, 0x03343436U, 0x03353436U, 0x03363436U, 0x03373436U,
+    0x03383436U, 0x03393436U, 0x03303536U, 0x03313536U, 0x03323536U, 0x03333536U, 0x03343536U, 0x03353536U,
+    0x03363536U, 0x03373536U, 0x03383536U, 0x03393536U, 0x03303636U, 0x03313636U, 0x03323636U, 0x03333636U,
+    0x03343636U, 0x03353636U, 0x03363636U, 0x03373636U, 0x03383636U, 0x03393636U, 0x03303736U, 0x03313736U,
+    0x03323736U, 0x03333736U, 0x03343736U, 0x03353736U, 0x03363736U, 0x03373736U, 0x03383736U, 0x03393736U,
+    0x03303836U, 0x03313836U, 0x03323836U, 0x03333836U, 0x03343836U, 0x03353836U, 0x03363836U, 0x03373836U,
+    0x03383836U, 0x03393836U, 0x03303936U, 0x03313936U, 0x03323936U, 0x03333936U, 0x03343936U, 0x03353936U,
+    0x03363936U, 0x03373936U, 0x03383936U, 0x03393936U, 0x03303037U, 0x03313037U, 0x03323037U, 0x03333037U,
+    0x03343037U, 0x03353037U, 0x03363037U, 0x03373037U, 0x03383037U, 0x03393037U, 0x03303137U, 0x03313137U,
+    0x03323137U, 0x03333137U, 0x03343137U, 0x03353137U, 0x03363137U, 0x03373137U, 0x03383137U, 0x03393137U,
+    0x03303237U, 0x03313237U, 0x03323237U, 0x03333237U, 0x03343237U, 0x03353237U, 0x03363237U, 0x03373237U,
+    0x03383237U, 0x03393237U, 0x03303337U, 0x03313337U, 0x03323337U, 0x03333337U, 0x03343337U, 0x03353337U,
+    0x03363337U, 0x03373337U, 0x03383337U, 0x03393337U, 0x03303437U, 0x03313437U, 0x03323437U, 0x03333437U,
+    0x03343437U, 0x03353437U, 0x03363437U, 0x03373437U, 0x03383437U, 0x03393437U, 0x03303537U, 0x03313537U,
+    0x03323537U, 0x03333537U, 0x03343537U, 0x03353537U, 0x03363537U, 0x03373537U, 0x03383537U, 0x03393537U,
+    0x03303637U, 0x03313637U, 0x03323637U, 0x03333637U, 0x03343637U, 0x03353637U, 0x03363637U, 0x03373637U,
+    0x03383637U, 0x03393637U, 0x03303737U, 0x03313737U, 0x03323737U, 0x03333737U, 0x03343737U, 0x03353737U,
+    0x03363737U, 0x03373737U, 0x03383737U, 0x03393737U, 0x03303837U, 0x03313837U, 0x03323837U, 0x03333837U,
+    0x03343837U, 0x03353837U, 0x03363837U, 0x03373837U, 0x03383837U, 0x03393837U, 0x03303937U, 0x03313937U,
+    0x03323937U, 0x03333937U, 0x03343937U, 0x03353937U, 0x03363937U, 0x03373937U, 0x03383937U, 0x03393937U,
+    0x03303038U, 0x03313038U, 0x03323038U, 0x03333038U, 0x03343038U, 0x03353038U, 0x03363038U, 0x03373038U,
+    0x03383038U, 0x03393038U, 0x03303138U, 0x03313138U, 0x03323138U, 0x03333138U, 0x03343138U, 0x03353138U,
+    0x03363138U, 0x03373138U, 0x03383138U, 0x03393138U, 0x03303238U, 0x03313238U, 0x03323238U, 0x03333238U,
+    0x03343238U, 0x03353238U, 0x03363238U, 0x03373238U, 0x03383238U, 0x03393238U, 0x03303338U, 0x03313338U,
+    0x03323338U, 0x03333338U, 0x03343338U, 0x03353338U, 0x03363338U, 0x03373338U, 0x03383338U, 0x03393338U,
+    0x03303438U, 0x03313438U, 0x03323438U, 0x03333438U, 0x03343438U, 0x03353438U, 0x03363438U, 0x03373438U,
+    0x03383438U, 0x03393438U, 0x03303538U, 0x03313538U, 0x03323538U, 0x03333538U, 0x03343538U, 0x03353538U,
+    0x03363538U, 0x03373538U, 0x03383538U, 0x03393538U, 0x03303638U, 0x03313638U, 0x03323638U, 0x03333638U,
+    0x03343638U, 0x03353638U, 0x03363638U, 0x03373638U, 0x03383638U, 0x03393638U, 0x03303738U, 0x03313738U,
+    0x03323738U, 0x03333738U, 0x03343738U, 0x03353738U, 0x03363738U, 0x03373738U, 0x03383738U, 0x03393738U,
+    0x03303838U, 0x03313838U, 0x03323838U, 0x03333838U, 0x03343838U, 0x03353838U, 0x03363838U, 0x03373838U,
+    0x03383838U, 0x03393838U, 0x03303938U, 0x03313938U, 0x03323938U, 0x03333938U, 0x03343938U, 0x03353938U,
+    0x03363938U, 0x03373938U, 0x03383938U, 0x03393938U, 0x03303039U, 0x03313039U, 0x03323039U, 0x03333039U,
+    0x03343039U, 0x03353039U, 0x03363039U, 0x03373039U, 0x03383039U, 0x03393039U, 0x03303139U, 0x03313139U,
+    0x03323139U, 0x03333139U, 0x03343139U, 0x03353139U, 0x03363139U, 0x03373139U, 0x03383139U, 0x03393139U,
+    0x03303239U, 0x03313239U, 0x03323239U, 0x03333239U, 0x03343239U, 0x03353239U, 0x03363239U, 0x03373239U,
+    0x03383239U, 0x03393239U, 0x03303339U, 0x03313339U, 0x03323339U, 0x03333339U, 0x03343339U, 0x03353339U,
+    0x03363339U, 0x03373339U, 0x03383339U, 0x03393339U, 0x03303439U, 0x03313439U, 0x03323439U, 0x03333439U,
+    0x03343439U, 0x03353439U, 0x03363439U, 0x03373439U, 0x03383439U, 0x03393439U, 0x03303539U, 0x03313539U,
+    0x03323539U, 0x03333539U, 0x03343539U, 0x03353539U, 0x03363539U, 0x03373539U, 0x03383539U, 0x03393539U,
+    0x03303639U, 0x03313639U, 0x03323639U, 0x03333639U, 0x03343639U, 0x03353639U, 0x03363639U, 0x03373639U,
+    0x03383639U, 0x03393639U, 0x03303739U, 0x03313739U, 0x03323739U, 0x03333739U, 0x03343739U, 0x03353739U,
+    0x03363739U, 0x03373739U, 0x03383739U, 0x03393739U, 0x03303839U, 0x03313839U, 0x03323839U, 0x03333839U,
+    0x03343839U, 0x03353839U, 0x03363839U, 0x03373839U, 0x03383839U, 0x03393839U, 0x03303939U, 0x03313939U,
+    0x03323939U, 0x03333939U, 0x03343939U, 0x03353939U, 0x03363939U, 0x03373939U, 0x03383939U, 0x03393939U
+};
+#endif
+
+#if !defined(USF_DISABLE_RADIX_SUPPORT)
+constexpr char digits_radix_lowercase[]{"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"};
+constexpr char digits_radix_uppercase[]{"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"};
+#endif
 
 class Integer
 {
@@ -76,79 +243,98 @@ class Integer
             return pow10_uint64_lut[index];
         }
 
-        // -------- COUNT DIGITS ----------------------------------------------
-        // Based on the code from:
-        // http://graphics.stanford.edu/~seander/bithacks.html#IntegerLog10
-        // --------------------- ----------------------------------------------
-
-        static USF_CPP14_CONSTEXPR int count_digits_dec(const uint32_t n) noexcept
+#if defined(USF_INT128_SUPPORT)
+        static USF_CPP14_CONSTEXPR uint128_t pow10_uint128(const int index) noexcept
         {
-            if(n < 10) return 1;
+            assert(index >= 0 && index < 39);
 
-            // The algorithm below doesn't work when `n` is 0 because:
-            // 1. the result of __builtin_clz() is undefined if `n` is 0.
-            // 2. the `pow10_uint32_lut` lookup table has the value 1 in
-            //    the first element and not a 0 as the algorithm expects.
-            // (both cases are covered by the previous if statement or
-            //  by the slower commented OR operation below).
+            return (index < 20) ? pow10_uint64_lut[index]
+                                : static_cast<uint128_t>(pow10_uint64_lut[index - 19]) * pow10_uint64_lut[19];
+        }
+#endif
 
-            // n = n | 1;
+        // -------- COUNT DIGITS ----------------------------------------------
+        // All the digit counts are computed in constant time (no loops and no
+        // branches) from the bit width of the value. The value is ORed with 1
+        // so that __builtin_clz() is never called with 0 (undefined result)
+        // and 0 is still counted as a single digit.
+        // --------------------- ----------------------------------------------
 
-            const int t = (32 - __builtin_clz(n)) * 1233 >> 12;
-            return t - (n < pow10_uint32_lut[t]) + 1;
+        static USF_CPP14_CONSTEXPR int bit_width(const uint32_t n) noexcept
+        {
+            return 32 - __builtin_clz(n | 1U);
         }
 
-        static USF_CPP14_CONSTEXPR int count_digits_dec(const uint64_t n) noexcept
+        static USF_CPP14_CONSTEXPR int bit_width(const uint64_t n) noexcept
         {
-            if(n <= std::numeric_limits<uint32_t>::max())
-            {
-                return count_digits_dec(static_cast<uint32_t>(n));
-            }
-
-            // The algorithm below doesn't work when `n` is 0 because:
-            // 1. the result of __builtin_clzll() is undefined if `n` is 0.
-            // 2. the `pow10_uint64_lut` lookup table has the value 1 in
-            //    the first element and not a 0 as the algorithm expects.
-            // (both cases are covered by the previous if statement or
-            //  by the slower commented OR operation below).
+            return 64 - __builtin_clzll(n | 1U);
+        }
 
-            // n = n | 1;
+#if defined(USF_INT128_SUPPORT)
+        static USF_CPP14_CONSTEXPR int bit_width(const uint128_t n) noexcept
+        {
+            const auto hi = static_cast<uint64_t>(n >> 64U);
 
-            const int t = (64 - __builtin_clzll(n)) * 1233 >> 12;
-            return t - (n < pow10_uint64_lut[t]) + 1;
+            return (hi != 0) ? 128 - __builtin_clzll(hi) : bit_width(static_cast<uint64_t>(n));
         }
+#endif
 
-        static USF_CPP14_CONSTEXPR int count_digits_bin(const uint32_t n) noexcept
+        // Based on the code from:
+        // https://lemire.me/blog/2021/06/03/computing-the-number-of-digits-of-an-integer-even-faster/
+        static USF_CPP14_CONSTEXPR int count_digits_dec(const uint32_t n) noexcept
         {
-            // The result of __builtin_clz() is undefined if `n` is 0.
-            return (n < 2) ? 1 : (32 - __builtin_clz(n));
+            return static_cast<int>((n + count_digits_dec_lut[bit_width(n) - 1]) >> 32U);
         }
 
-        static USF_CPP14_CONSTEXPR int count_digits_bin(const uint64_t n) noexcept
+        // Based on the code from:
+        // http://graphics.stanford.edu/~seander/bithacks.html#IntegerLog10
+        static USF_CPP14_CONSTEXPR int count_digits_dec(const uint64_t n) noexcept
         {
-            // The result of __builtin_clzll() is undefined if `n` is 0.
-            return (n < 2) ? 1 : (64 - __builtin_clzll(n));
+            // Since the powers of 10 (except 10^0) are even, `n | 1` compares
+            // against them exactly as `n` does, but it also counts 0 as 1 digit.
+            const uint64_t m = n | 1U;
+
+            const int t = bit_width(m) * 1233 >> 12;
+            return t - static_cast<int>(m < pow10_uint64_lut[t]) + 1;
         }
 
-        template <typename T,
-                  typename std::enable_if<std::numeric_limits<T>::is_integer && std::is_unsigned<T>::value, bool>::type = true>
-        static USF_CPP14_CONSTEXPR int count_digits_oct(T n) noexcept
+#if defined(USF_INT128_SUPPORT)
+        static USF_CPP14_CONSTEXPR int count_digits_dec(const uint128_t n) noexcept
         {
-            int digits = 1;
-            while((n >>= 3U) != 0) { ++digits; }
-            return digits;
+            if(static_cast<uint64_t>(n >> 64U) == 0)
+            {
+                return count_digits_dec(static_cast<uint64_t>(n));
+            }
+
+            // Same as the 64 bit version (n >= 2^64, so 20 digits or more)
+            const int t = bit_width(n) * 1233 >> 12;
+            return t - static_cast<int>(n < pow10_uint128(t)) + 1;
         }
+#endif
 
-        template <typename T,
-                  typename std::enable_if<std::numeric_limits<T>::is_integer && std::is_unsigned<T>::value, bool>::type = true>
-        static USF_CPP14_CONSTEXPR int count_digits_hex(T n) noexcept
+        // Number of digits in a power of 2 base (2^Bits).
+        template <int Bits, typename T> static USF_CPP14_CONSTEXPR
+        int count_digits_pow2(const T n) noexcept
         {
-            int digits = 1;
-            while((n >>= 4U) != 0) { ++digits; }
-            return digits;
+            return (bit_width(n) + (Bits - 1)) / Bits;
         }
 
-        // -------- FAST DIVIDE BY 10 -----------------------------------------
+        static USF_CPP14_CONSTEXPR int count_digits_bin(const uint32_t n) noexcept { return count_digits_pow2<1>(n); }
+        static USF_CPP14_CONSTEXPR int count_digits_bin(const uint64_t n) noexcept { return count_digits_pow2<1>(n); }
+
+        static USF_CPP14_CONSTEXPR int count_digits_oct(const uint32_t n) noexcept { return count_digits_pow2<3>(n); }
+        static USF_CPP14_CONSTEXPR int count_digits_oct(const uint64_t n) noexcept { return count_digits_pow2<3>(n); }
+
+        static USF_CPP14_CONSTEXPR int count_digits_hex(const uint32_t n) noexcept { return count_digits_pow2<4>(n); }
+        static USF_CPP14_CONSTEXPR int count_digits_hex(const uint64_t n) noexcept { return count_digits_pow2<4>(n); }
+
+#if defined(USF_INT128_SUPPORT)
+        static USF_CPP14_CONSTEXPR int count_digits_bin(const uint128_t n) noexcept { return count_digits_pow2<1>(n); }
+        static USF_CPP14_CONSTEXPR int count_digits_oct(const uint128_t n) noexcept { return count_digits_pow2<3>(n); }
+        static USF_CPP14_CONSTEXPR int count_digits_hex(const uint128_t n) noexcept { return count_digits_pow2<4>(n); }
+#endif
+
+        // -------- FAST DIVIDE BY 10 / 100 -----------------------------------
         // Based on the code from Hacker's Delight:
         // http://www.hackersdelight.org/divcMore.pdf
         // --------------------- ----------------------------------------------
@@ -189,6 +375,22 @@ class Integer
 #endif
         }
 
+        static USF_CPP14_CONSTEXPR uint32_t div100(const uint32_t n) noexcept
+        {
+#if defined(__arm__)
+            uint32_t q = (n >> 1) + (n >> 3) + (n >> 6) - (n >> 10) + (n >> 12) + (n >> 13) - (n >> 16);
+            q += (q >> 20);
+            q >>= 6;
+
+            const uint32_t r = n - q * 100;
+
+            return q + ((r + 28) >> 7);
+            // return q + (r > 99);
+#else
+            return n / 100;
+#endif
+        }
+
         // -------- CONVERTERS ------------------------------------------------
         // The following converters write the value from back to front.
         // It is assumed that the pointer `dst` is already placed at the
@@ -200,109 +402,730 @@ class Integer
         // array -> [........]
         // dst   ->      ^
 
+#if !defined(USF_DISABLE_SMALL_INTEGER_LUT)
+        // -------- SMALL DECIMAL CONVERSION ----------------------------------
+        // Values in the range [0, 999] are converted by a table lookup. Unlike
+        // the other converters, the digits are written from front to back and
+        // `dst` is advanced past the last digit. If there is `room` for it the
+        // digits are written with a single 4 byte store (narrow chars only, not
+        // in a constant expression).
+        // --------------------- ----------------------------------------------
+        static USF_CPP14_CONSTEXPR int count_digits_small(const uint32_t value) noexcept
+        {
+            assert(value < 1000);
+
+            return static_cast<int>(small_dec_lut[value] >> 24U);
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_dec_small(CharT*& dst, const uint32_t value, const std::ptrdiff_t room) noexcept
+        {
+            assert(value < 1000);
+
+            uint32_t entry = small_dec_lut[value];
+            const auto digits = static_cast<int>(entry >> 24U);
+
+#if defined(USF_TARGET_LITTLE_ENDIAN) && defined(USF_IS_CONSTANT_EVALUATED)
+            if(sizeof(CharT) == 1 && room >= 4 && !USF_IS_CONSTANT_EVALUATED())
+            {
+                std::memcpy(dst, &entry, 4);
+                dst += digits;
+                return;
+            }
+#else
+            (void)room;
+#endif
+            for(int i = 0; i < digits; ++i)
+            {
+                *dst++ = static_cast<CharT>(entry & 0xFFU);
+                entry >>= 8U;
+            }
+        }
+#endif // !defined(USF_DISABLE_SMALL_INTEGER_LUT)
+
         // -------- DECIMAL CONVERSION ----------------------------------------
+        // Two digits are written per iteration from the `digits_dec_pairs`
+        // lookup table. 64 bit values are split in chunks of 10^8 so that
+        // most of the conversion is made using 32 bit arithmetic.
+        // --------------------- ----------------------------------------------
         template <typename CharT>
         static USF_CPP14_CONSTEXPR void convert_dec(CharT* dst, uint32_t value) noexcept
         {
-            do
+            while(value >= 100)
             {
                 const uint32_t v = value;
-                value = div10(value);
-                *(--dst) = static_cast<CharT>('0' + (v - (value * 10)));
-            }while(value);
+                value = div100(value);
+                write_dec_pair(dst, v - (value * 100));
+            }
+
+            if(value >= 10)
+            {
+                write_dec_pair(dst, value);
+            }
+            else
+            {
+                *(--dst) = static_cast<CharT>('0' + value);
+            }
         }
 
         template <typename CharT>
         static USF_CPP14_CONSTEXPR void convert_dec(CharT* dst, uint64_t value) noexcept
         {
+#if defined(USF_SIMD_SSE2) && defined(USF_IS_CONSTANT_EVALUATED)
+            // The SSE2 kernel is not constexpr
+            if(value >= 100000000U && !USF_IS_CONSTANT_EVALUATED())
+            {
+                convert_dec_sse2(dst, value);
+                return;
+            }
+#endif
+            convert_dec_scalar(dst, value);
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_dec_scalar(CharT* dst, uint64_t value) noexcept
+        {
             while(value > std::numeric_limits<uint32_t>::max())
             {
                 const uint64_t v = value;
-                value = div10(value);
-                *(--dst) = static_cast<CharT>('0' + (v - (value * 10)));
+                value /= 100000000U;
+                convert_dec_8_digits(dst, static_cast<uint32_t>(v - (value * 100000000U)));
             }
 
             convert_dec(dst, static_cast<uint32_t>(value));
         }
 
-        // -------- BINARY CONVERSION -----------------------------------------
+        // Writes exactly `count` digits (padded with leading zeros).
         template <typename CharT>
-        static USF_CPP14_CONSTEXPR void convert_bin(CharT* dst, uint32_t value) noexcept
+        static USF_CPP14_CONSTEXPR void convert_dec_digits(CharT*& dst, const uint32_t value, const int count) noexcept
         {
-            do
+            convert_dec_digits(dst, static_cast<uint64_t>(value), count);
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_dec_digits(CharT*& dst, const uint64_t value, const int count) noexcept
+        {
+            convert_dec(dst, value);
+
+            dst -= count;
+
+            CharT* it = dst;
+            CharTraits::assign(it, '0', count - count_digits_dec(value));
+        }
+
+#if defined(USF_INT128_SUPPORT)
+        // 128 bit values are split in chunks of 10^19 (the largest power of
+        // 10 that fits in 64 bits) that are converted by the 64 bit kernels.
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_dec(CharT* dst, uint128_t value) noexcept
+        {
+            while(static_cast<uint64_t>(value >> 64U) != 0)
             {
-                const uint32_t v = value;
-                value >>= 1U;
-                *(--dst) = static_cast<CharT>('0' + (v - (value << 1U)));
-            }while(value);
+                const uint128_t v = value;
+                value /= pow10_uint64_lut[19];
+                convert_dec_digits(dst, static_cast<uint64_t>(v - (value * pow10_uint64_lut[19])), 19);
+            }
+
+            convert_dec(dst, static_cast<uint64_t>(value));
         }
 
         template <typename CharT>
-        static USF_CPP14_CONSTEXPR void convert_bin(CharT* dst, uint64_t value) noexcept
+        static USF_CPP14_CONSTEXPR void convert_dec_digits(CharT*& dst, uint128_t value, int count) noexcept
         {
-            while(value > std::numeric_limits<uint32_t>::max())
+            for(; static_cast<uint64_t>(value >> 64U) != 0; count -= 19)
             {
+                const uint128_t v = value;
+                value /= pow10_uint64_lut[19];
+                convert_dec_digits(dst, static_cast<uint64_t>(v - (value * pow10_uint64_lut[19])), 19);
+            }
+
+            convert_dec_digits(dst, static_cast<uint64_t>(value), count);
+        }
+#endif
+
+#if defined(USF_SIMD_SSE2)
+        // -------- DECIMAL CONVERSION (SSE2) ---------------------------------
+        // Converts 8 digits in parallel (16 bit lanes) using multiply-high
+        // by reciprocal constants. Based on the code from:
+        // https://github.com/miloyip/itoa-benchmark (u64toa_sse2)
+        // --------------------- ----------------------------------------------
+        template <typename CharT>
+        static void convert_dec_sse2(CharT* dst, uint64_t value) noexcept
+        {
+            assert(value >= 100000000U);
+
+            if(value >= 10000000000000000U)
+            {
+                // 17 to 20 digits: 16 lower digits in parallel
+                // and the remaining (up to 4) upper digits after.
                 const uint64_t v = value;
-                value >>= 1U;
-                *(--dst) = static_cast<CharT>('0' + (v - (value << 1U)));
+                value /= 10000000000000000U;
+
+                write_sse2_digits(dst, convert_16_digits_sse2(v - (value * 10000000000000000U)), 16);
+                convert_dec(dst, static_cast<uint32_t>(value));
             }
+            else
+            {
+                // 9 to 16 digits
+                write_sse2_digits(dst, convert_16_digits_sse2(value), count_digits_dec(value));
+            }
+        }
+#endif // defined(USF_SIMD_SSE2)
 
-            convert_bin(dst, static_cast<uint32_t>(value));
+        // -------- BINARY / OCTAL / HEXADECIMAL CONVERSION -------------------
+        // Word parallel (SWAR) conversion: the digits are spread into the 8
+        // bytes of a 64 bit word (one digit per byte, least significant digit
+        // in the lowest byte) and converted to ASCII at once. The xxx_digits()
+        // variants write exactly `count` digits, padding with leading zeros.
+        // --------------------- ----------------------------------------------
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_bin(CharT* dst, const uint32_t value) noexcept
+        {
+            convert_bin_digits(dst, value, count_digits_bin(value));
         }
 
-        // -------- OCTAL CONVERSION ------------------------------------------
         template <typename CharT>
-        static USF_CPP14_CONSTEXPR void convert_oct(CharT* dst, uint32_t value) noexcept
+        static USF_CPP14_CONSTEXPR void convert_bin(CharT* dst, const uint64_t value) noexcept
         {
-            do
+            convert_bin_digits(dst, value, count_digits_bin(value));
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_bin_digits(CharT*& dst, const uint32_t value, const int count) noexcept
+        {
+            convert_bin_digits(dst, static_cast<uint64_t>(value), count);
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_bin_digits(CharT*& dst, uint64_t value, int count) noexcept
+        {
+            while(count > 0)
             {
-                const uint32_t v = value;
-                value >>= 3U;
-                *(--dst) = static_cast<CharT>('0' + (v - (value << 3U)));
-            }while(value);
+                // 8 digits (bits) per word
+                const int n = std::min(count, 8);
+                write_swar_digits(dst, spread_bin(static_cast<uint32_t>(value & 0xFFU)) + 0x3030303030303030U, n);
+                value >>= 8U;
+                count -= n;
+            }
         }
 
         template <typename CharT>
-        static USF_CPP14_CONSTEXPR void convert_oct(CharT* dst, uint64_t value) noexcept
+        static USF_CPP14_CONSTEXPR void convert_oct(CharT* dst, const uint32_t value) noexcept
         {
-            while(value > std::numeric_limits<uint32_t>::max())
+            convert_oct_digits(dst, value, count_digits_oct(value));
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_oct(CharT* dst, const uint64_t value) noexcept
+        {
+            convert_oct_digits(dst, value, count_digits_oct(value));
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_oct_digits(CharT*& dst, const uint32_t value, const int count) noexcept
+        {
+            convert_oct_digits(dst, static_cast<uint64_t>(value), count);
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_oct_digits(CharT*& dst, uint64_t value, int count) noexcept
+        {
+            while(count > 0)
             {
-                const uint64_t v = value;
-                value >>= 3U;
-                *(--dst) = static_cast<CharT>('0' + (v - (value << 3U)));
+                // 8 digits (24 bits) per word
+                const int n = std::min(count, 8);
+                write_swar_digits(dst, spread_oct(static_cast<uint32_t>(value & 0xFFFFFFU)) + 0x3030303030303030U, n);
+                value >>= 24U;
+                count -= n;
             }
+        }
 
-            convert_oct(dst, static_cast<uint32_t>(value));
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_hex(CharT* dst, const uint32_t value, const bool uppercase) noexcept
+        {
+            convert_hex_digits(dst, value, count_digits_hex(value), uppercase);
         }
 
-        // -------- HEXADECIMAL CONVERSION ------------------------------------
         template <typename CharT>
-        static USF_CPP14_CONSTEXPR void convert_hex(CharT* dst, uint32_t value, const bool uppercase) noexcept
+        static USF_CPP14_CONSTEXPR void convert_hex(CharT* dst, const uint64_t value, const bool uppercase) noexcept
         {
-            const char* digits = uppercase ? digits_hex_uppercase : digits_hex_lowercase;
+#if defined(USF_SIMD_SSSE3) && defined(USF_IS_CONSTANT_EVALUATED)
+            // The SSSE3 kernel is not constexpr
+            if(value > std::numeric_limits<uint32_t>::max() && !USF_IS_CONSTANT_EVALUATED())
+            {
+                write_sse2_digits(dst, convert_hex_ssse3(value, uppercase), count_digits_hex(value));
+                return;
+            }
+#endif
+            convert_hex_digits(dst, value, count_digits_hex(value), uppercase);
+        }
 
-            do
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_hex_digits(CharT*& dst, const uint32_t value, const int count, const bool uppercase) noexcept
+        {
+            convert_hex_digits(dst, static_cast<uint64_t>(value), count, uppercase);
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_hex_digits(CharT*& dst, uint64_t value, int count, const bool uppercase) noexcept
+        {
+            while(count > 0)
             {
-                const uint32_t v = value;
-                value >>= 4U;
-                *(--dst) = static_cast<CharT>(digits[v - (value << 4U)]);
-            }while(value);
+                // 8 digits (32 bits) per word
+                const int n = std::min(count, 8);
+                write_swar_digits(dst, hex_to_ascii(spread_hex(static_cast<uint32_t>(value)), uppercase), n);
+                value >>= 32U;
+                count -= n;
+            }
+        }
 
+#if defined(USF_INT128_SUPPORT)
+        // 128 bit values are converted by the 64 bit kernels in chunks of
+        // 64 bits (binary and hexadecimal) or 63 bits (octal).
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_bin(CharT* dst, const uint128_t value) noexcept
+        {
+            convert_bin_digits(dst, value, count_digits_bin(value));
         }
 
         template <typename CharT>
-        static USF_CPP14_CONSTEXPR void convert_hex(CharT* dst, uint64_t value, const bool uppercase) noexcept
+        static USF_CPP14_CONSTEXPR void convert_bin_digits(CharT*& dst, uint128_t value, int count) noexcept
         {
-            const char* digits = uppercase ? digits_hex_uppercase : digits_hex_lowercase;
+            for(; count > 64; count -= 64, value >>= 64U)
+            {
+                convert_bin_digits(dst, static_cast<uint64_t>(value), 64);
+            }
 
-            while(value > std::numeric_limits<uint32_t>::max())
+            convert_bin_digits(dst, static_cast<uint64_t>(value), count);
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_oct(CharT* dst, const uint128_t value) noexcept
+        {
+            convert_oct_digits(dst, value, count_digits_oct(value));
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_oct_digits(CharT*& dst, uint128_t value, int count) noexcept
+        {
+            for(; count > 21; count -= 21, value >>= 63U)
+            {
+                convert_oct_digits(dst, static_cast<uint64_t>(value) & 0x7FFFFFFFFFFFFFFFU, 21);
+            }
+
+            convert_oct_digits(dst, static_cast<uint64_t>(value), count);
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_hex(CharT* dst, const uint128_t value, const bool uppercase) noexcept
+        {
+            convert_hex_digits(dst, value, count_digits_hex(value), uppercase);
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_hex_digits(CharT*& dst, uint128_t value, int count, const bool uppercase) noexcept
+        {
+            for(; count > 16; count -= 16, value >>= 64U)
+            {
+                convert_hex_digits(dst, static_cast<uint64_t>(value), 16, uppercase);
+            }
+
+            convert_hex_digits(dst, static_cast<uint64_t>(value), count, uppercase);
+        }
+#endif
+
+#if !defined(USF_DISABLE_RADIX_SUPPORT)
+        // -------- ARBITRARY RADIX CONVERSION --------------------------------
+        // The digits are converted by a function specialized for each base
+        // so that the divisions by the base are turned into multiplications
+        // by the compiler. Digits above 9 are the letters a-z followed by A-Z
+        // (A-Z followed by a-z when uppercase), so bases up to 36 are case
+        // insensitive as usual. Bases range is [2, 62].
+        // --------------------- ----------------------------------------------
+        template <typename T>
+        static USF_CPP14_CONSTEXPR int count_digits_radix(const T n, const unsigned base) noexcept
+        {
+            assert(base >= 2 && base <= 62);
+
+            // Largest value that can be multiplied by the base without overflow
+            const T limit = (static_cast<T>(0) - 1U) / base;
+
+            int digits = 1;
+
+            for(T p = base; n >= p; p *= base)
+            {
+                ++digits;
+
+                if(p > limit) { break; }
+            }
+
+            return digits;
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_radix(CharT* dst, const uint32_t value,
+                                                      const unsigned base, const bool uppercase) noexcept
+        {
+            convert_radix(dst, static_cast<uint64_t>(value), base, uppercase);
+        }
+
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_radix(CharT* dst, const uint64_t value,
+                                                      const unsigned base, const bool uppercase) noexcept
+        {
+            convert_radix_digits<2, 62>(dst, value, count_digits_radix(value, base), base,
+                                        uppercase ? digits_radix_uppercase : digits_radix_lowercase);
+        }
+
+#if defined(USF_INT128_SUPPORT)
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_radix(CharT* dst, uint128_t value,
+                                                      const unsigned base, const bool uppercase) noexcept
+        {
+            const char* digits = uppercase ? digits_radix_uppercase : digits_radix_lowercase;
+
+            // Largest power of the base that fits in 64 bits
+            uint64_t chunk = base;
+            int chunk_digits = 1;
+
+            while(chunk <= std::numeric_limits<uint64_t>::max() / base)
+            {
+                chunk *= base;
+                ++chunk_digits;
+            }
+
+            // The value is split in chunks that are converted by the 64 bit conversion
+            while(static_cast<uint64_t>(value >> 64U) != 0)
+            {
+                const uint128_t v = value;
+                value /= chunk;
+                convert_radix_digits<2, 62>(dst, static_cast<uint64_t>(v - (value * chunk)), chunk_digits, base, digits);
+            }
+
+            convert_radix_digits<2, 62>(dst, static_cast<uint64_t>(value),
+                                        count_digits_radix(static_cast<uint64_t>(value), base), base, digits);
+        }
+#endif
+
+        // Writes exactly `count` digits (padded with leading zeros).
+        template <unsigned Base, typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_radix_digits(CharT*& dst, uint64_t value, int count, const char* digits) noexcept
+        {
+            static_assert(Base >= 2 && Base <= 62, "Integer::convert_radix_digits(): invalid base!");
+
+            for(; count > 0; --count)
             {
                 const uint64_t v = value;
-                value >>= 4U;
-                *(--dst) = static_cast<CharT>(digits[v - (value << 4U)]);
+                value /= Base;
+                *(--dst) = static_cast<CharT>(digits[v - (value * Base)]);
+            }
+        }
+#endif // !defined(USF_DISABLE_RADIX_SUPPORT)
+
+        // -------- GROUPED CONVERSION ----------------------------------------
+        // Same as the above converters but a separator character is placed
+        // between each group of digits while converting (groups of 3 digits
+        // for decimal and groups of 4 digits for the power of 2 bases). The
+        // number of characters written is given by count_grouped().
+        // --------------------- ----------------------------------------------
+        static USF_CPP14_CONSTEXPR int count_grouped(const int digits, const int group_size) noexcept
+        {
+            return digits + ((digits - 1) / group_size);
+        }
+
+        template <typename CharT, typename T>
+        static USF_CPP14_CONSTEXPR void convert_dec_grouped(CharT* dst, const T value, const CharT separator) noexcept
+        {
+            const auto head = write_dec_groups(dst, value, (count_digits_dec(value) - 1) / 3, separator);
+
+            convert_dec(dst, static_cast<uint32_t>(head));
+        }
+
+#if defined(USF_INT128_SUPPORT)
+        template <typename CharT>
+        static USF_CPP14_CONSTEXPR void convert_dec_grouped(CharT* dst, uint128_t value, const CharT separator) noexcept
+        {
+            // Chunks of 10^18 (6 groups) converted by the 64 bit kernels
+            while(static_cast<uint64_t>(value >> 64U) != 0)
+            {
+                const uint128_t v = value;
+                value /= pow10_uint64_lut[18];
+                write_dec_groups(dst, static_cast<uint64_t>(v - (value * pow10_uint64_lut[18])), 6, separator);
+            }
+
+            convert_dec_grouped(dst, static_cast<uint64_t>(value), separator);
+        }
+#endif
+
+        template <typename CharT, typename T>
+        static USF_CPP14_CONSTEXPR void convert_bin_grouped(CharT* dst, T value, const CharT separator) noexcept
+        {
+            int count = count_digits_bin(value);
+
+            for(; count > 4; count -= 4, value >>= 4U)
+            {
+                convert_bin_digits(dst, static_cast<uint64_t>(value) & 0xFU, 4);
+                *(--dst) = separator;
+            }
+
+            convert_bin_digits(dst, static_cast<uint64_t>(value), count);
+        }
+
+        template <typename CharT, typename T>
+        static USF_CPP14_CONSTEXPR void convert_oct_grouped(CharT* dst, T value, const CharT separator) noexcept
+        {
+            int count = count_digits_oct(value);
+
+            for(; count > 4; count -= 4, value >>= 12U)
+            {
+                convert_oct_digits(dst, static_cast<uint64_t>(value) & 0xFFFU, 4);
+                *(--dst) = separator;
+            }
+
+            convert_oct_digits(dst, static_cast<uint64_t>(value), count);
+        }
+
+        template <typename CharT, typename T>
+        static USF_CPP14_CONSTEXPR void convert_hex_grouped(CharT* dst, T value, const bool uppercase, const CharT separator) noexcept
+        {
+            int count = count_digits_hex(value);
+
+            for(; count > 4; count -= 4, value >>= 16U)
+            {
+                convert_hex_digits(dst, static_cast<uint64_t>(value) & 0xFFFFU, 4, uppercase);
+                *(--dst) = separator;
             }
 
-            convert_hex(dst, static_cast<uint32_t>(value), uppercase);
+            convert_hex_digits(dst, static_cast<uint64_t>(value), count, uppercase);
+        }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE STATIC FUNCTIONS
+        // --------------------------------------------------------------------
+
+        // -------- SWAR HELPERS ----------------------------------------------
+
+        // Spreads the 8 bits of `value` (range [0, 255]) into 8 bytes.
+        static USF_CPP14_CONSTEXPR uint64_t spread_bin(const uint32_t value) noexcept
+        {
+            // Replicate the value into all bytes, isolate bit `i` in byte `i`
+            // and move it to the bottom of the byte (adding 0x7F carries to
+            // the top bit of the byte only if it is not zero).
+            const uint64_t x = ((value * 0x0101010101010101U) & 0x8040201008040201U) + 0x7F7F7F7F7F7F7F7FU;
+
+            return (x >> 7U) & 0x0101010101010101U;
+        }
+
+        // Spreads the 8 groups of 3 bits of `value` (range [0, 2^24 - 1]) into 8 bytes.
+        static USF_CPP14_CONSTEXPR uint64_t spread_oct(const uint32_t value) noexcept
+        {
+            uint64_t x = value;
+
+            x = (x | (x << 20U)) & 0x00000FFF00000FFFU;
+            x = (x | (x << 10U)) & 0x003F003F003F003FU;
+            x = (x | (x <<  5U)) & 0x0707070707070707U;
+
+            return x;
+        }
+
+        // Spreads the 8 nibbles of `value` into 8 bytes.
+        static USF_CPP14_CONSTEXPR uint64_t spread_hex(const uint32_t value) noexcept
+        {
+            uint64_t x = value;
+
+            x = (x | (x << 16U)) & 0x0000FFFF0000FFFFU;
+            x = (x | (x <<  8U)) & 0x00FF00FF00FF00FFU;
+            x = (x | (x <<  4U)) & 0x0F0F0F0F0F0F0F0FU;
+
+            return x;
+        }
+
+        // Converts 8 spread nibbles to hexadecimal ASCII digits.
+        static USF_CPP14_CONSTEXPR uint64_t hex_to_ascii(const uint64_t x, const bool uppercase) noexcept
+        {
+            // 1 in each byte with a nibble greater than 9
+            const uint64_t letters = ((x + 0x0606060606060606U) >> 4U) & 0x0101010101010101U;
+
+            // 'A' - '9' - 1 = 7, 'a' - '9' - 1 = 39
+            return x + 0x3030303030303030U + (letters * (uppercase ? 7U : 39U));
+        }
+
+        // Writes the `count` lowest bytes of `digits` (up to 8) backwards.
+        template <typename CharT> USF_ALWAYS_INLINE static USF_CPP14_CONSTEXPR
+        void write_swar_digits(CharT*& dst, uint64_t digits, const int count) noexcept
+        {
+#if defined(USF_TARGET_LITTLE_ENDIAN) && defined(USF_IS_CONSTANT_EVALUATED)
+            if(sizeof(CharT) == 1 && count == 8 && !USF_IS_CONSTANT_EVALUATED())
+            {
+                // Full word: store all the digits at once (most significant
+                // digit at the lowest address). Not allowed in a constant
+                // expression, where the bytes are written one by one.
+                digits = __builtin_bswap64(digits);
+                dst -= 8;
+                std::memcpy(dst, &digits, 8);
+                return;
+            }
+#endif
+            for(int i = 0; i < count; ++i)
+            {
+                *(--dst) = static_cast<CharT>(digits & 0xFFU);
+                digits >>= 8U;
+            }
+        }
+
+#if defined(USF_SIMD_SSSE3)
+        // Returns the 16 hexadecimal ASCII digits of `value`, including any
+        // leading zeros, the most significant digit first (nibble spreading
+        // followed by a PSHUFB table lookup).
+        static __m128i convert_hex_ssse3(const uint64_t value, const bool uppercase) noexcept
+        {
+            const __m128i v  = _mm_set_epi64x(0, static_cast<long long>(value));
+            const __m128i lo = _mm_and_si128(v, _mm_set1_epi8(0x0F));
+            const __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+
+            // Least significant nibble first
+            const __m128i nibbles = _mm_unpacklo_epi8(lo, hi);
+
+            const __m128i table = uppercase
+                                ? _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F')
+                                : _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+            // Table lookup and reversal to most significant digit first
+            const __m128i digits = _mm_shuffle_epi8(table, nibbles);
+
+            return _mm_shuffle_epi8(digits, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+        }
+#endif // defined(USF_SIMD_SSSE3)
+
+#if defined(USF_SIMD_SSE2)
+        // Returns the 8 digits of `value` (range [0, 99999999]) in the lower
+        // 8 x 16 bit lanes, the most significant digit in the first lane.
+        static __m128i convert_8_digits_sse2(const uint32_t value) noexcept
+        {
+            // abcd, efgh = abcdefgh divmod 10000
+            const __m128i abcdefgh = _mm_cvtsi32_si128(static_cast<int>(value));
+            const __m128i abcd = _mm_srli_epi64(_mm_mul_epu32(abcdefgh, _mm_set1_epi32(static_cast<int>(0xD1B71759U))), 45);
+            const __m128i efgh = _mm_sub_epi32(abcdefgh, _mm_mul_epu32(abcd, _mm_set1_epi32(10000)));
+
+            // v1 = [abcd, efgh, 0, 0, 0, 0, 0, 0]
+            const __m128i v1 = _mm_unpacklo_epi16(abcd, efgh);
+
+            // v2 = [abcd * 4, abcd * 4, abcd * 4, abcd * 4, efgh * 4, efgh * 4, efgh * 4, efgh * 4]
+            const __m128i v1a = _mm_slli_epi64(v1, 2);
+            const __m128i v2a = _mm_unpacklo_epi16(v1a, v1a);
+            const __m128i v2  = _mm_unpacklo_epi32(v2a, v2a);
+
+            // v4 = v2 div 10^3, 10^2, 10^1, 10^0 = [a, ab, abc, abcd, e, ef, efg, efgh]
+            // (the reciprocals are followed by the shifts that complete
+            //  each division, -32768 is the 16 bit pattern of 1 << 15)
+            const __m128i v3 = _mm_mulhi_epu16(v2, _mm_setr_epi16(8389, 5243, 13108, -32768, 8389, 5243, 13108, -32768));
+            const __m128i v4 = _mm_mulhi_epu16(v3, _mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, -32768, 1 << 7, 1 << 11, 1 << 13, -32768));
+
+            // v5 = v4 * 10 = [a0, ab0, abc0, abcd0, e0, ef0, efg0, efgh0]
+            const __m128i v5 = _mm_mullo_epi16(v4, _mm_set1_epi16(10));
+
+            // v6 = v5 << 16 = [0, a0, ab0, abc0, 0, e0, ef0, efg0]
+            const __m128i v6 = _mm_slli_epi64(v5, 16);
+
+            // v7 = v4 - v6 = [a, b, c, d, e, f, g, h]
+            return _mm_sub_epi16(v4, v6);
+        }
+
+        // Returns the 16 ASCII digits of `value` (range [0, 10^16 - 1]),
+        // including any leading zeros, the most significant digit first.
+        static __m128i convert_16_digits_sse2(const uint64_t value) noexcept
+        {
+            const auto hi = static_cast<uint32_t>(value / 100000000U);
+            const auto lo = static_cast<uint32_t>(value - (static_cast<uint64_t>(hi) * 100000000U));
+
+            const __m128i digits = _mm_packus_epi16(convert_8_digits_sse2(hi), convert_8_digits_sse2(lo));
+
+            return _mm_add_epi8(digits, _mm_set1_epi8('0'));
+        }
+
+        // Writes the last `count` characters of the 16 ASCII digits backwards.
+        template <typename CharT>
+        static void write_sse2_digits(CharT*& dst, const __m128i digits, const int count) noexcept
+        {
+            char buffer[16];
+            std::memcpy(buffer, &digits, sizeof(buffer));
+
+            dst -= count;
+
+            CharT* it = dst;
+            CharTraits::copy(it, buffer + (16 - count), count);
+        }
+#endif // defined(USF_SIMD_SSE2)
+
+        // Writes the two digits of `value` (range [0, 99]) backwards.
+        template <typename CharT> USF_ALWAYS_INLINE static USF_CPP14_CONSTEXPR
+        void write_dec_pair(CharT*& dst, const uint32_t value) noexcept
+        {
+            const char* pair = digits_dec_pairs + (value * 2);
+
+            *(--dst) = static_cast<CharT>(pair[1]);
+            *(--dst) = static_cast<CharT>(pair[0]);
+        }
+
+#if !defined(USF_DISABLE_RADIX_SUPPORT)
+        // Binary search of the runtime `base` in the range [Lo, Hi] to select
+        // the conversion specialized for that base.
+        template <unsigned Lo, unsigned Hi, typename CharT, typename std::enable_if<(Lo < Hi), bool>::type = true>
+        static USF_CPP14_CONSTEXPR void convert_radix_digits(CharT*& dst, const uint64_t value, const int count,
+                                                             const unsigned base, const char* digits) noexcept
+        {
+            if(base <= (Lo + Hi) / 2)
+            {
+                convert_radix_digits<Lo, (Lo + Hi) / 2>(dst, value, count, base, digits);
+            }
+            else
+            {
+                convert_radix_digits<(Lo + Hi) / 2 + 1, Hi>(dst, value, count, base, digits);
+            }
+        }
+
+        template <unsigned Lo, unsigned Hi, typename CharT, typename std::enable_if<(Lo == Hi), bool>::type = true>
+        static USF_CPP14_CONSTEXPR void convert_radix_digits(CharT*& dst, const uint64_t value, const int count,
+                                                             const unsigned, const char* digits) noexcept
+        {
+            convert_radix_digits<Lo>(dst, value, count, digits);
+        }
+#endif // !defined(USF_DISABLE_RADIX_SUPPORT)
+
+        // Writes `groups` groups of 3 digits of `value` backwards, each one
+        // preceded by `separator`. Returns the remaining (upper) value.
+        template <typename CharT, typename T> static USF_CPP14_CONSTEXPR
+        T write_dec_groups(CharT*& dst, T value, int groups, const CharT separator) noexcept
+        {
+            for(; groups > 0; --groups)
+            {
+                const T v = value;
+                value /= 1000U;
+
+                const auto group = static_cast<uint32_t>(v - (value * 1000U));
+                const uint32_t hundreds = div100(group);
+
+                write_dec_pair(dst, group - (hundreds * 100));
+                *(--dst) = static_cast<CharT>('0' + hundreds);
+                *(--dst) = separator;
+            }
+
+            return value;
+        }
+
+        // Writes exactly 8 digits of `value` (range [0, 99999999]) backwards,
+        // including any leading zeros.
+        template <typename CharT> static USF_CPP14_CONSTEXPR
+        void convert_dec_8_digits(CharT*& dst, uint32_t value) noexcept
+        {
+            for(int i = 0; i < 4; ++i)
+            {
+                const uint32_t v = value;
+                value = div100(value);
+                write_dec_pair(dst, v - (value * 100));
+            }
         }
 };
 
@@ -9,8 +9,205 @@
 
 namespace usf
 {
+// ----------------------------------------------------------------------------
+// Format string parsed once at runtime (up to `MaxSpecs` argument specs) and
+// applied many times by format_to(), without parsing or validating the specs
+// again. The literal text is referenced, not copied: the format string must
+// outlive the compiled format.
+// ----------------------------------------------------------------------------
+template <typename CharT, int MaxSpecs>
+class CompiledFormat
+{
+    public:
+
+        // --------------------------------------------------------------------
+        // TEMPLATE PARAMETERS VALIDATION
+        // --------------------------------------------------------------------
+
+        static_assert(MaxSpecs > 0 && MaxSpecs < 128, "usf::CompiledFormat: MaxSpecs must be in the range [1, 127].");
+
+        // --------------------------------------------------------------------
+        // PUBLIC DEFINITIONS
+        // --------------------------------------------------------------------
+
+        // Literal text before, between or after the argument specs. The
+        // escaped braces ("{{" and "}}") are unescaped when it is written.
+        struct Literal
+        {
+            const CharT* text;
+            int          size;
+            bool         escaped;
+        };
+
+        // --------------------------------------------------------------------
+        // PUBLIC MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        // Empty format string
+        constexpr CompiledFormat() noexcept = default;
+
+        // Same parsing as the process() loop: literal text followed by
+        // argument specs, each one followed by literal text.
+        explicit USF_CPP14_CONSTEXPR CompiledFormat(BasicStringView<CharT> fmt)
+        {
+            // Argument's sequential index
+            int arg_seq_index = 0;
+
+            m_literals[0] = parse_literal(fmt);
+
+            while(!fmt.empty())
+            {
+                USF_ENFORCE(m_spec_count < MaxSpecs, std::runtime_error);
+
+                // Any index below the arguments limit (checked against the
+                // actual number of arguments when applied)
+                const internal::ArgFormat<CharT> format(fmt, 127);
+
+                // Determine which argument index to use, sequential or positional.
+                int arg_index = format.index();
+
+                if(arg_index < 0) { arg_index = arg_seq_index++; }
+
+                m_arg_count = std::max(m_arg_count, arg_index + 1);
+
+                m_specs      [m_spec_count] = format;
+                m_arg_indexes[m_spec_count] = static_cast<int8_t>(arg_index);
+
+                m_literals[++m_spec_count] = parse_literal(fmt);
+            }
+        }
+
+        // Number of argument specs and of arguments needed
+        inline constexpr int spec_count() const noexcept { return m_spec_count; }
+        inline constexpr int arg_count () const noexcept { return m_arg_count;  }
+
+        // Literal text before the spec `index` (the last one, at `spec_count()`,
+        // follows the last spec).
+        inline constexpr const Literal& literal(const int index) const noexcept { return m_literals[index]; }
+
+        inline constexpr const internal::ArgFormat<CharT>& spec(const int index) const noexcept { return m_specs[index]; }
+
+        inline constexpr int arg_index(const int index) const noexcept { return static_cast<int>(m_arg_indexes[index]); }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE STATIC FUNCTIONS
+        // --------------------------------------------------------------------
+
+        // Literal text up to the next argument spec (same rules as
+        // parse_format_string()).
+        static USF_CPP14_CONSTEXPR Literal parse_literal(BasicStringView<CharT>& fmt)
+        {
+            const CharT* it = fmt.cbegin();
+
+            bool escaped = false;
+
+            while(it < fmt.cend())
+            {
+                if(*it == '{')
+                {
+                    if(it + 1 == fmt.cend() || *(it + 1) != '{') { break; }
+
+                    escaped = true;
+                    it += 2;
+                }
+                else if(*it == '}')
+                {
+                    USF_ENFORCE(it + 1 < fmt.cend() && *(it + 1) == '}', std::runtime_error);
+
+                    escaped = true;
+                    it += 2;
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            const Literal literal{fmt.cbegin(), static_cast<int>(it - fmt.cbegin()), escaped};
+
+            fmt.remove_prefix(it - fmt.cbegin());
+
+            return literal;
+        }
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER VARIABLES
+        // --------------------------------------------------------------------
+
+        static constexpr auto kMaxSpecs = static_cast<std::size_t>(MaxSpecs);
+
+        Literal                    m_literals   [kMaxSpecs + 1]{};
+        internal::ArgFormat<CharT> m_specs      [kMaxSpecs]{};
+        int8_t                     m_arg_indexes[kMaxSpecs]{};
+        int                        m_spec_count = 0;
+        int                        m_arg_count  = 0;
+};
+
+#if defined(USF_ENABLE_PARSE_CACHE)
+// Format string parse cache counters (of the calling thread)
+struct ParseCacheStats
+{
+    uint64_t hits;
+    uint64_t misses;
+};
+#endif
+
 namespace internal
 {
+inline namespace USF_ENGINE_NAMESPACE
+{
+
+// -------- LITERAL TEXT SCANNING ---------------------------------------------
+// Length of the literal text (up to `count` chars) before the first brace.
+// The char strings are first skipped 16 chars at a time with SSE2 (8 at a
+// time in a 64 bit word otherwise) up to the block holding the brace, which
+// is then searched by the scalar loop.
+// --------------------- -----------------------------------------------------
+template <typename CharT>
+inline std::ptrdiff_t literal_length(const CharT* const text, const std::ptrdiff_t count,
+                                     std::ptrdiff_t index = 0) noexcept
+{
+    while(index < count && text[index] != '{' && text[index] != '}') { ++index; }
+
+    return index;
+}
+
+inline std::ptrdiff_t literal_length(const char* const text, const std::ptrdiff_t count) noexcept
+{
+    std::ptrdiff_t index = 0;
+
+#if defined(USF_SIMD_SSE2)
+    const __m128i open  = _mm_set1_epi8('{');
+    const __m128i close = _mm_set1_epi8('}');
+
+    for(; index + 16 <= count; index += 16)
+    {
+        __m128i chars;
+        std::memcpy(&chars, text + index, sizeof(chars));
+
+        if(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chars, open), _mm_cmpeq_epi8(chars, close))) != 0) { break; }
+    }
+#else
+    // A byte is zero (exact test, no false positive) after the xor with the
+    // brace it is equal to.
+    const auto has_zero_byte = [](const uint64_t value) noexcept
+    {
+        return ~(((value & UINT64_C(0x7F7F7F7F7F7F7F7F)) + UINT64_C(0x7F7F7F7F7F7F7F7F)) | value | UINT64_C(0x7F7F7F7F7F7F7F7F));
+    };
+
+    for(; index + 8 <= count; index += 8)
+    {
+        uint64_t chars = 0;
+        std::memcpy(&chars, text + index, sizeof(chars));
+
+        if((has_zero_byte(chars ^ UINT64_C(0x7B7B7B7B7B7B7B7B)) | has_zero_byte(chars ^ UINT64_C(0x7D7D7D7D7D7D7D7D))) != 0) { break; }
+    }
+#endif
+
+    return literal_length<char>(text, count, index);
+}
 
 template <typename CharT> USF_CPP14_CONSTEXPR
 void parse_format_string(usf::BasicStringSpan<CharT>& str, usf::BasicStringView<CharT>& fmt)
@@ -44,6 +241,20 @@ void parse_format_string(usf::BasicStringSpan<CharT>& str, usf::BasicStringView<
         }
         else
         {
+#if defined(USF_IS_CONSTANT_EVALUATED)
+            if(!USF_IS_CONSTANT_EVALUATED())
+            {
+                // Copy the literal text up to the next brace (or the end of
+                // one of the strings) at once
+                const std::ptrdiff_t count = literal_length(fmt_it, std::min(fmt.cend() - fmt_it, str.end() - str_it));
+
+                std::memcpy(str_it, fmt_it, static_cast<std::size_t>(count) * sizeof(CharT));
+
+                str_it += count;
+                fmt_it += count;
+                continue;
+            }
+#endif
             // Copy literal text
             *str_it++ = *fmt_it++;
         }
@@ -86,10 +297,410 @@ void process(usf::BasicStringSpan<CharT>& str, usf::BasicStringView<CharT>& fmt,
     }
 }
 
+// Writes a literal text of a compiled format.
+template <typename CharT, int MaxSpecs> USF_CPP14_CONSTEXPR
+void write_literal(usf::BasicStringSpan<CharT>& str, const typename CompiledFormat<CharT, MaxSpecs>::Literal& literal)
+{
+    // The unescaped text is never longer (room for the null terminator)
+    USF_ENFORCE(literal.size < str.size(), std::runtime_error);
+
+    if(literal.escaped)
+    {
+        usf::BasicStringView<CharT> text(literal.text, literal.size);
+
+        parse_format_string(str, text);
+    }
+    else
+    {
+        CharT* it = str.begin();
+
+        CharTraits::copy(it, literal.text, literal.size);
+
+        str.remove_prefix(literal.size);
+    }
+}
+
+// Same as the process() loop above with the specs already parsed.
+template <typename CharT, int MaxSpecs> USF_CPP14_CONSTEXPR
+void process(usf::BasicStringSpan<CharT>& str, const CompiledFormat<CharT, MaxSpecs>& fmt,
+             const Argument<CharT>* const args, const int arg_count)
+{
+    USF_ENFORCE(fmt.arg_count() <= arg_count, std::runtime_error);
+
+    write_literal<CharT, MaxSpecs>(str, fmt.literal(0));
+
+    for(int index = 0; index < fmt.spec_count(); ++index)
+    {
+        ArgFormat<CharT> format = fmt.spec(index);
+
+        args[fmt.arg_index(index)].format(str, format);
+
+        write_literal<CharT, MaxSpecs>(str, fmt.literal(index + 1));
+    }
+}
+
+#if defined(USF_ENABLE_PARSE_CACHE)
+// -------- FORMAT STRING PARSE CACHE ----------------------------------------
+// Direct mapped cache of compiled format strings, one per thread (no locking
+// needed) and char type. The entry is selected by the format string address
+// and length and matched against a copy of its text, so a format string
+// rebuilt in the same buffer is parsed again instead of reusing stale specs.
+// --------------------- -----------------------------------------------------
+template <typename CharT>
+class ParseCache
+{
+    public:
+
+        // --------------------------------------------------------------------
+        // PUBLIC TYPE ALIASES
+        // --------------------------------------------------------------------
+
+        using Format = CompiledFormat<CharT, USF_PARSE_CACHE_MAX_SPECS>;
+
+        static_assert(USF_PARSE_CACHE_SIZE > 0 && (USF_PARSE_CACHE_SIZE & (USF_PARSE_CACHE_SIZE - 1)) == 0,
+                      "usf::ParseCache: USF_PARSE_CACHE_SIZE must be a power of 2!");
+        static_assert(USF_PARSE_CACHE_MAX_LENGTH > 0,
+                      "usf::ParseCache: USF_PARSE_CACHE_MAX_LENGTH must be positive!");
+
+        // --------------------------------------------------------------------
+        // PUBLIC STATIC FUNCTIONS
+        // --------------------------------------------------------------------
+
+        static ParseCache& instance() noexcept
+        {
+            static thread_local ParseCache cache;
+
+            return cache;
+        }
+
+        // --------------------------------------------------------------------
+        // PUBLIC MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        // Returns the compiled format string (compiled now on a miss) or
+        // nullptr if it is too long or has too many argument specs to be
+        // cached.
+        const Format* find(const usf::BasicStringView<CharT> fmt)
+        {
+            const uint64_t address = reinterpret_cast<std::uintptr_t>(fmt.data());
+            const uint64_t hash = (address ^ static_cast<uint64_t>(fmt.size())) * UINT64_C(0x9E3779B97F4A7C15);
+
+            Entry& entry = m_entries[(hash >> 32U) & (USF_PARSE_CACHE_SIZE - 1U)];
+
+            if(entry.key == fmt.data() && entry.size == fmt.size()
+               && std::memcmp(entry.text, fmt.data(), static_cast<std::size_t>(fmt.size()) * sizeof(CharT)) == 0)
+            {
+                ++m_stats.hits;
+                return &entry.format;
+            }
+
+            ++m_stats.misses;
+
+            if(fmt.size() > USF_PARSE_CACHE_MAX_LENGTH || count_specs(fmt) > USF_PARSE_CACHE_MAX_SPECS) { return nullptr; }
+
+            // The entry stays invalid if the format string is invalid (throws).
+            // It is compiled from the copy, so its literals don't point into
+            // the caller's buffer.
+            entry.key = nullptr;
+            std::memcpy(entry.text, fmt.data(), static_cast<std::size_t>(fmt.size()) * sizeof(CharT));
+            entry.format = Format(usf::BasicStringView<CharT>(entry.text, fmt.size()));
+            entry.key = fmt.data();
+            entry.size = fmt.size();
+
+            return &entry.format;
+        }
+
+        void clear() noexcept
+        {
+            for(Entry& entry : m_entries) { entry.key = nullptr; }
+
+            m_stats = ParseCacheStats{0, 0};
+        }
+
+        ParseCacheStats stats() const noexcept { return m_stats; }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE DEFINITIONS
+        // --------------------------------------------------------------------
+
+        struct Entry
+        {
+            const CharT*   key  = nullptr;
+            std::ptrdiff_t size = 0;
+            CharT          text[USF_PARSE_CACHE_MAX_LENGTH]{};
+            Format         format{};
+        };
+
+        // --------------------------------------------------------------------
+        // PRIVATE STATIC FUNCTIONS
+        // --------------------------------------------------------------------
+
+        // Number of argument specs (an escaped '{' is skipped)
+        static int count_specs(const usf::BasicStringView<CharT> fmt) noexcept
+        {
+            int count = 0;
+
+            for(const CharT* it = fmt.cbegin(); it < fmt.cend(); ++it)
+            {
+                if(*it == '{')
+                {
+                    if(it + 1 < fmt.cend() && *(it + 1) == '{') { ++it; } else { ++count; }
+                }
+            }
+
+            return count;
+        }
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER VARIABLES
+        // --------------------------------------------------------------------
+
+        Entry           m_entries[USF_PARSE_CACHE_SIZE]{};
+        ParseCacheStats m_stats{0, 0};
+};
+#endif // defined(USF_ENABLE_PARSE_CACHE)
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+// Writes one value of a floating point array. Values with a valid `scaled`
+// (`value` * 10^Precision rounded) or that can be scaled are written directly,
+// the others (large or not finite) go through the general conversion. A
+// negative `Precision` always uses the general conversion.
+template <int Precision, typename CharT, typename T>
+void format_floats_value(CharT*& it, CharT* const end, const T value, uint64_t scaled,
+                         bool scaled_valid, ArgFormat<CharT>& format)
+{
+    if(!scaled_valid && Precision >= 0)
+    {
+        scaled_valid = Float::round_scaled(scaled, std::fabs(static_cast<double>(value)), Precision);
+    }
+
+    if(scaled_valid)
+    {
+        const int ipart_digits = Integer::count_digits_dec(scaled / Integer::pow10_uint32(Precision));
+        const bool negative = std::signbit(value);
+
+        USF_ENFORCE(it + static_cast<int>(negative) + ipart_digits + Precision + 1 < end, std::runtime_error);
+
+        if(negative) { *it++ = '-'; }
+
+        Argument<CharT>::write_float_scaled(it, scaled, Precision, ipart_digits, Precision > 0);
+    }
+    else
+    {
+        usf::BasicStringSpan<CharT> str(it, end);
+
+        Argument<CharT>(value).format(str, format);
+
+        it = str.begin();
+    }
+}
+
+template <typename CharT>
+void format_floats_separator(CharT*& it, const CharT* const end, const usf::BasicStringView<CharT> separator)
+{
+    USF_ENFORCE(it + separator.size() < end, std::runtime_error);
+
+    CharTraits::copy(it, separator.data(), separator.size());
+}
+
+// Formats the array of floating point values. The scale and round steps are
+// made two values at a time when SSE2 is available.
+template <int Precision, typename CharT, typename T>
+void format_floats(CharT*& it, CharT* const end, const T* const values, const std::ptrdiff_t count,
+                   const usf::BasicStringView<CharT> separator, ArgFormat<CharT>& format)
+{
+    std::ptrdiff_t index = 0;
+
+#if defined(USF_SIMD_SSE2)
+    for(; Precision >= 0 && index + 2 <= count; index += 2)
+    {
+        uint64_t scaled[2];
+        const int valid = Float::round_scaled_sse2(scaled, values + index, Precision);
+
+        if(index > 0) { format_floats_separator(it, end, separator); }
+        format_floats_value<Precision>(it, end, values[index], scaled[0], (valid & 1) != 0, format);
+
+        format_floats_separator(it, end, separator);
+        format_floats_value<Precision>(it, end, values[index + 1], scaled[1], (valid & 2) != 0, format);
+    }
+#endif
+
+    for(; index < count; ++index)
+    {
+        if(index > 0) { format_floats_separator(it, end, separator); }
+        format_floats_value<Precision>(it, end, values[index], 0, false, format);
+    }
+}
+#endif // !defined(USF_DISABLE_FLOAT_SUPPORT)
+
+#if USF_CPP14_OR_GREATER
+// -------- COMPILE-TIME FORMAT STRING ----------------------------------------
+// The format string of USF_FMT() is split at compile time in segments of
+// literal text and argument specs (parsed and validated by the ArgFormat
+// constructor in a constant expression, so an invalid spec fails to
+// compile). Each segment is then expanded into its own copy or argument
+// conversion call: nothing is parsed at runtime.
+// --------------------- -----------------------------------------------------
+
+// Literal text to copy (an escaped brace ends the segment and only the first
+// brace is copied) or argument spec ("{...}") with the argument index.
+struct FormatSegment
+{
+    int begin;
+    int size;
+    int next;       // Start of the next segment
+    int arg_index;  // -1 for literal text
+};
+
+// Holds the format string in the static view() function of `String`.
+template <typename String>
+struct FormatString
+{
+    using char_type = typename decltype(String::view())::char_type;
+};
+
+template <typename CharT, std::size_t N> constexpr
+BasicStringView<CharT> make_format_view(const CharT (&str)[N])
+{
+    return BasicStringView<CharT>(str, static_cast<std::ptrdiff_t>(N - 1));
+}
+
+// Segment starting at `pos` (same rules as parse_format_string() and process()).
+template <typename CharT> constexpr
+FormatSegment scan_format_segment(const BasicStringView<CharT> fmt, const int pos, int& arg_seq_index)
+{
+    const auto size = static_cast<int>(fmt.size());
+
+    int it = pos;
+
+    for(; it < size; ++it)
+    {
+        if(fmt[it] == '{')
+        {
+            if(it + 1 < size && fmt[it + 1] == '{') { return FormatSegment{pos, it + 1 - pos, it + 2, -1}; }
+
+            break;
+        }
+
+        if(fmt[it] == '}')
+        {
+            USF_ENFORCE(it + 1 < size && fmt[it + 1] == '}', std::runtime_error);
+
+            return FormatSegment{pos, it + 1 - pos, it + 2, -1};
+        }
+    }
+
+    if(it > pos) { return FormatSegment{pos, it - pos, it, -1}; }
+
+    // Any index below the arguments limit (checked against the actual
+    // number of arguments when the segment is expanded)
+    BasicStringView<CharT> spec(fmt.cbegin() + pos, fmt.cend());
+    const ArgFormat<CharT> format(spec, 127);
+
+    const int next = size - static_cast<int>(spec.size());
+
+    return FormatSegment{pos, next - pos, next, (format.index() < 0) ? arg_seq_index++ : format.index()};
+}
+
+template <typename CharT> constexpr
+int format_segment_count(const BasicStringView<CharT> fmt)
+{
+    int count = 0;
+    int arg_seq_index = 0;
+
+    for(int pos = 0; pos < fmt.size(); ++count)
+    {
+        pos = scan_format_segment(fmt, pos, arg_seq_index).next;
+    }
+
+    return count;
+}
+
+template <typename CharT> constexpr
+FormatSegment format_segment(const BasicStringView<CharT> fmt, const int index)
+{
+    int arg_seq_index = 0;
+
+    FormatSegment segment = scan_format_segment(fmt, 0, arg_seq_index);
+
+    for(int i = 0; i < index; ++i)
+    {
+        segment = scan_format_segment(fmt, segment.next, arg_seq_index);
+    }
+
+    return segment;
+}
+
+template <typename CharT> constexpr
+ArgFormat<CharT> format_segment_spec(const BasicStringView<CharT> fmt, const FormatSegment segment)
+{
+    BasicStringView<CharT> spec(fmt.cbegin() + segment.begin, segment.size);
+
+    return ArgFormat<CharT>(spec, 127);
+}
+
+template <int Index, typename T, typename... Args,
+          typename std::enable_if<Index == 0, bool>::type = true> constexpr
+const T& nth_argument(const T& arg, const Args&...) noexcept
+{
+    return arg;
+}
+
+template <int Index, typename T, typename... Args,
+          typename std::enable_if<(Index > 0), bool>::type = true> constexpr
+decltype(auto) nth_argument(const T&, const Args&... args) noexcept
+{
+    return nth_argument<Index - 1>(args...);
+}
+
+// Literal text: fixed size copy.
+template <typename String, int Index, typename CharT, typename... Args> USF_ALWAYS_INLINE inline
+void format_segment_to(BasicStringSpan<CharT>& str, std::false_type, const Args&...)
+{
+    constexpr FormatSegment segment = format_segment(String::view(), Index);
+
+    USF_ENFORCE(segment.size < str.size(), std::runtime_error);
+
+    std::memcpy(str.begin(), String::view().cbegin() + segment.begin, sizeof(CharT) * static_cast<std::size_t>(segment.size));
+
+    str.remove_prefix(segment.size);
+}
+
+// Argument: conversion with the spec parsed at compile time.
+template <typename String, int Index, typename CharT, typename... Args> USF_ALWAYS_INLINE inline
+void format_segment_to(BasicStringSpan<CharT>& str, std::true_type, const Args&... args)
+{
+    constexpr FormatSegment segment = format_segment(String::view(), Index);
+
+    static_assert(segment.arg_index < static_cast<int>(sizeof...(Args)),
+                  "usf::format_to(): the format string refers to a missing argument!");
+
+    constexpr ArgFormat<CharT> spec = format_segment_spec(String::view(), segment);
+
+    ArgFormat<CharT> format = spec;
+
+    make_argument<CharT>(nth_argument<segment.arg_index>(args...)).format(str, format);
+}
+
+template <typename String, typename CharT, int... Index, typename... Args> USF_ALWAYS_INLINE inline
+void format_segments_to(BasicStringSpan<CharT>& str, std::integer_sequence<int, Index...>, const Args&... args)
+{
+    const int expand[]{0, (format_segment_to<String, Index>(str,
+        std::integral_constant<bool, (format_segment(String::view(), Index).arg_index >= 0)>{}, args...), 0)...};
+
+    static_cast<void>(expand);
+}
+#endif // USF_CPP14_OR_GREATER
+
+} // inline namespace USF_ENGINE_NAMESPACE
 } // namespace internal
 
 
 
+inline namespace USF_ENGINE_NAMESPACE
+{
 
 template <typename CharT, typename... Args> USF_CPP14_CONSTEXPR
 BasicStringSpan<CharT> basic_format_to(BasicStringSpan<CharT> str, BasicStringView<CharT> fmt)
@@ -119,7 +730,22 @@ BasicStringSpan<CharT> basic_format_to(BasicStringSpan<CharT> str, BasicStringVi
 
     const internal::Argument<CharT> arguments[sizeof...(Args)]{internal::make_argument<CharT>(args)...};
 
+#if defined(USF_ENABLE_PARSE_CACHE) && defined(USF_IS_CONSTANT_EVALUATED)
+    // The format string is only parsed on a cache miss. The cache (thread
+    // local) can't be used in a constant expression.
+    const auto compiled = USF_IS_CONSTANT_EVALUATED() ? nullptr : internal::ParseCache<CharT>::instance().find(fmt);
+
+    if(compiled != nullptr)
+    {
+        internal::process(str, *compiled, arguments, static_cast<int>(sizeof...(Args)));
+    }
+    else
+    {
+        internal::process(str, fmt, arguments, static_cast<int>(sizeof...(Args)));
+    }
+#else
     internal::process(str, fmt, arguments, static_cast<int>(sizeof...(Args)));
+#endif
 
 #if !defined(USF_DISABLE_STRING_TERMINATION)
     // If not disabled in configuration, null terminate the resulting string.
@@ -136,6 +762,144 @@ CharT* basic_format_to(CharT* str, const std::ptrdiff_t str_count, BasicStringVi
     return basic_format_to(BasicStringSpan<CharT>(str, str_count), fmt, args...).end();
 }
 
+#if defined(USF_ENABLE_PARSE_CACHE)
+// ----------------------------------------------------------------------------
+// Format string parse cache of the calling thread (per char type)
+// ----------------------------------------------------------------------------
+template <typename CharT = char>
+ParseCacheStats parse_cache_stats() noexcept
+{
+    return internal::ParseCache<CharT>::instance().stats();
+}
+
+// Removes all the entries and resets the counters (e.g. before reusing the
+// memory of a cached format string).
+template <typename CharT = char>
+void parse_cache_clear() noexcept
+{
+    internal::ParseCache<CharT>::instance().clear();
+}
+#endif // defined(USF_ENABLE_PARSE_CACHE)
+
+// Formats with a format string compiled at runtime by usf::CompiledFormat.
+template <typename CharT, int MaxSpecs> USF_CPP14_CONSTEXPR
+BasicStringSpan<CharT> basic_format_to(BasicStringSpan<CharT> str, const CompiledFormat<CharT, MaxSpecs>& fmt)
+{
+    auto str_begin = str.begin();
+
+    internal::process(str, fmt, static_cast<const internal::Argument<CharT>*>(nullptr), 0);
+
+#if !defined(USF_DISABLE_STRING_TERMINATION)
+    // If not disabled in configuration, null terminate the resulting string.
+    str[0] = CharT{};
+#endif
+
+    // Return a string span to the resulting string
+    return BasicStringSpan<CharT>(str_begin, str.begin());
+}
+
+template <typename CharT, int MaxSpecs, typename... Args> USF_CPP14_CONSTEXPR
+BasicStringSpan<CharT> basic_format_to(BasicStringSpan<CharT> str, const CompiledFormat<CharT, MaxSpecs>& fmt, Args&&... args)
+{
+    static_assert(sizeof...(Args) < 128, "usf::basic_format_to(): crazy number of arguments supplied!");
+
+    auto str_begin = str.begin();
+
+    const internal::Argument<CharT> arguments[sizeof...(Args)]{internal::make_argument<CharT>(args)...};
+
+    internal::process(str, fmt, arguments, static_cast<int>(sizeof...(Args)));
+
+#if !defined(USF_DISABLE_STRING_TERMINATION)
+    // If not disabled in configuration, null terminate the resulting string.
+    str[0] = CharT{};
+#endif
+
+    // Return a string span to the resulting string
+    return BasicStringSpan<CharT>(str_begin, str.begin());
+}
+
+template <typename CharT, int MaxSpecs, typename... Args> USF_CPP14_CONSTEXPR
+CharT* basic_format_to(CharT* str, const std::ptrdiff_t str_count, const CompiledFormat<CharT, MaxSpecs>& fmt, Args&&... args)
+{
+    return basic_format_to(BasicStringSpan<CharT>(str, str_count), fmt, args...).end();
+}
+
+#if USF_CPP14_OR_GREATER
+// Formats with a format string compiled by USF_FMT().
+template <typename CharT, typename String, typename... Args>
+BasicStringSpan<CharT> basic_format_to(BasicStringSpan<CharT> str, internal::FormatString<String>, Args&&... args)
+{
+    static_assert(std::is_same<CharT, typename internal::FormatString<String>::char_type>::value,
+                  "usf::basic_format_to(): the format string and the destination have different char types!");
+
+    auto str_begin = str.begin();
+
+    internal::format_segments_to<String>(str, std::make_integer_sequence<int, internal::format_segment_count(String::view())>{}, args...);
+
+#if !defined(USF_DISABLE_STRING_TERMINATION)
+    // If not disabled in configuration, null terminate the resulting string.
+    str[0] = CharT{};
+#endif
+
+    // Return a string span to the resulting string
+    return BasicStringSpan<CharT>(str_begin, str.begin());
+}
+
+template <typename CharT, typename String, typename... Args>
+CharT* basic_format_to(CharT* str, const std::ptrdiff_t str_count, internal::FormatString<String> fmt, Args&&... args)
+{
+    return basic_format_to(BasicStringSpan<CharT>(str, str_count), fmt, args...).end();
+}
+#endif // USF_CPP14_OR_GREATER
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+// Formats an array of floating point values in fixed point format with the
+// same `precision` ("{:.<precision>f}"), joined by the `separator` string.
+// The format is only parsed once and the precisions up to 6 use a batched
+// conversion (the values that cannot be scaled to 52 bits use the general one).
+template <typename CharT, typename T>
+BasicStringSpan<CharT> basic_format_floats_to(BasicStringSpan<CharT> str, const T* const values, const std::ptrdiff_t count,
+                                              const int precision, const BasicStringView<CharT> separator)
+{
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                  "usf::basic_format_floats_to(): only float and double values are supported!");
+
+    USF_ENFORCE(precision >= 0 && count >= 0, std::runtime_error);
+
+    // "{:.<precision>f}"
+    CharT spec[16]{'{', ':', '.'};
+    CharT* spec_it = spec + 3 + internal::Integer::count_digits_dec(static_cast<uint32_t>(precision));
+    internal::Integer::convert_dec(spec_it, static_cast<uint32_t>(precision));
+    *spec_it++ = 'f';
+    *spec_it++ = '}';
+
+    BasicStringView<CharT> spec_view(spec, spec_it - spec);
+    internal::ArgFormat<CharT> format(spec_view, 1);
+
+    CharT* it = str.begin();
+
+    switch(precision)
+    {
+        case 0: internal::format_floats<0>(it, str.end(), values, count, separator, format); break;
+        case 1: internal::format_floats<1>(it, str.end(), values, count, separator, format); break;
+        case 2: internal::format_floats<2>(it, str.end(), values, count, separator, format); break;
+        case 3: internal::format_floats<3>(it, str.end(), values, count, separator, format); break;
+        case 4: internal::format_floats<4>(it, str.end(), values, count, separator, format); break;
+        case 5: internal::format_floats<5>(it, str.end(), values, count, separator, format); break;
+        case 6: internal::format_floats<6>(it, str.end(), values, count, separator, format); break;
+        default: internal::format_floats<-1>(it, str.end(), values, count, separator, format); break;
+    }
+
+#if !defined(USF_DISABLE_STRING_TERMINATION)
+    // If not disabled in configuration, null terminate the resulting string.
+    *it = CharT{};
+#endif
+
+    // Return a string span to the resulting string
+    return BasicStringSpan<CharT>(str.begin(), it);
+}
+#endif // !defined(USF_DISABLE_FLOAT_SUPPORT)
+
 
 
 
@@ -154,6 +918,15 @@ char* format_to(char* str, const std::ptrdiff_t str_count, StringView fmt, Args&
     return basic_format_to(str, str_count, fmt, args...);
 }
 
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+template <typename T>
+StringSpan format_floats_to(StringSpan str, const T* const values, const std::ptrdiff_t count,
+                            const int precision, StringView separator)
+{
+    return basic_format_floats_to(str, values, count, precision, separator);
+}
+#endif
+
 // ----------------------------------------------------------------------------
 // Formats a wchar_t string 
 // ---------------------------------------------------------------------------
@@ -235,6 +1008,55 @@ uint8_t* format_to(uint8_t* str, const std::ptrdiff_t str_count, StringView fmt,
     return reinterpret_cast<uint8_t*>(basic_format_to(reinterpret_cast<char*>(str), str_count, fmt, args...));
 }
 
+// ----------------------------------------------------------------------------
+// Formats with a compiled format (any char type)
+// ----------------------------------------------------------------------------
+template <typename CharT, int MaxSpecs, typename... Args> USF_CPP14_CONSTEXPR
+BasicStringSpan<CharT> format_to(BasicStringSpan<CharT> str, const CompiledFormat<CharT, MaxSpecs>& fmt, Args&&... args)
+{
+    return basic_format_to(str, fmt, args...);
+}
+
+template <typename CharT, int MaxSpecs, typename... Args> USF_CPP14_CONSTEXPR
+CharT* format_to(CharT* str, const std::ptrdiff_t str_count, const CompiledFormat<CharT, MaxSpecs>& fmt, Args&&... args)
+{
+    return basic_format_to(str, str_count, fmt, args...);
+}
+
+#if USF_CPP14_OR_GREATER
+// ----------------------------------------------------------------------------
+// Formats with a compile-time format string (any char type)
+// ----------------------------------------------------------------------------
+template <typename CharT, typename String, typename... Args>
+BasicStringSpan<CharT> format_to(BasicStringSpan<CharT> str, internal::FormatString<String> fmt, Args&&... args)
+{
+    return basic_format_to(str, fmt, args...);
+}
+
+template <typename CharT, typename String, typename... Args>
+CharT* format_to(CharT* str, const std::ptrdiff_t str_count, internal::FormatString<String> fmt, Args&&... args)
+{
+    return basic_format_to(str, str_count, fmt, args...);
+}
+#endif // USF_CPP14_OR_GREATER
+
+} // inline namespace USF_ENGINE_NAMESPACE
 } // namespace usf
 
+#if USF_CPP14_OR_GREATER
+// ----------------------------------------------------------------------------
+// Compile-time format string (C++14 or greater), e.g.:
+// usf::format_to(str, USF_FMT("{} = {:.3f}"), name, value);
+// The format string is parsed and validated at compile time.
+// ----------------------------------------------------------------------------
+#define USF_FMT(str)                                                                        \
+    [] {                                                                                    \
+        struct UsfFormatString                                                              \
+        {                                                                                   \
+            static constexpr auto view() noexcept { return usf::internal::make_format_view(str); } \
+        };                                                                                  \
+        return usf::internal::FormatString<UsfFormatString>{};                              \
+    }()
+#endif // USF_CPP14_OR_GREATER
+
 #endif // USF_MAIN_HPP
@@ -13,6 +13,24 @@
 
 namespace usf
 {
+
+#if defined(USF_INT128_SUPPORT)
+// ----------------------------------------------------------------------------
+// 128 bit integer types (compiler extension)
+// ----------------------------------------------------------------------------
+
+__extension__ typedef          __int128  int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+#if defined(USF_FLOAT128_SUPPORT)
+// ----------------------------------------------------------------------------
+// 128 bit floating point type (compiler extension)
+// ----------------------------------------------------------------------------
+
+__extension__ typedef __float128 float128_t;
+#endif
+
 namespace internal
 {
 
@@ -63,6 +81,15 @@ class CharTraits
 template <typename T>
 struct always_false : std::false_type {};
 
+// std::is_unsigned is only true for the 128 bit types in GNU mode
+template <typename T>
+struct is_unsigned_integer : std::is_unsigned<T> {};
+
+#if defined(USF_INT128_SUPPORT)
+template <>
+struct is_unsigned_integer<uint128_t> : std::true_type {};
+#endif
+
 } // namespace internal
 } // namespace usf
 
@@ -15,6 +15,8 @@
 #include "usf/develop/usf_string_span.hpp"
 #include "usf/develop/usf_string_view.hpp"
 #include "usf/develop/usf_integer.hpp"
+#include "usf/develop/usf_bigint.hpp"
+#include "usf/develop/usf_decimal.hpp"
 #include "usf/develop/usf_float.hpp"
 #include "usf/develop/usf_arg_format.hpp"
 #include "usf/develop/usf_arg_custom_type.hpp"
@@ -30,11 +32,26 @@
 #  define TEST_STATIC_ASSERT(cond) assert(cond)
 #endif
 
+// Formats a single argument and compares the result with the expected string
+// (usable in constant expressions to check constexpr formatting)
+template <typename T>
+TEST_CONSTEXPR bool test_format_equal(const char* const fmt, const T value, const char* const expected)
+{
+    char str[64]{};
+
+    usf::format_to(str, 64, fmt, value);
+
+    int i = 0;
+    for(; expected[i] != 0; ++i) { if(str[i] != expected[i]) { return false; } }
+
+    return str[i] == 0;
+}
+
 #define USF_TEST_BASIC_TYPES
 #define USF_TEST_FORMAT_SPEC
 #define USF_TEST_POSITIONAL_ARGS
 #define USF_TEST_CUSTOM_TYPES
-//#define USF_TEST_FLOATING_POINT
+#define USF_TEST_FLOATING_POINT
 #define USF_TEST_BENCHMARKS
 #define USF_TEST_BENCHMARK_PRINTF
 //#define USF_TEST_BENCHMARK_FMT
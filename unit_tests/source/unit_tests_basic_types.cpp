@@ -3,6 +3,9 @@
 
 #if defined(USF_TEST_BASIC_TYPES)
 
+#include <cinttypes>
+#include <random>
+
 // ----------------------------------------------------------------------------
 // BASIC TYPES
 // ----------------------------------------------------------------------------
@@ -413,23 +416,23 @@ TEST_CASE("usf::format_to, basic types")
 
         char std_str[32]{};
 
-        usf::format_to(str, 128, "{}",   value); sprintf(std_str, "%g", static_cast<double>(value)); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{}",   value); CHECK_EQ(str, "123.45679");
         usf::format_to(str, 128, "{:f}", value); sprintf(std_str, "%f", static_cast<double>(value)); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:F}", value); sprintf(std_str, "%F", static_cast<double>(value)); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:e}", value); sprintf(std_str, "%e", static_cast<double>(value)); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:E}", value); sprintf(std_str, "%E", static_cast<double>(value)); CHECK_EQ(str, std_str);
-        usf::format_to(str, 128, "{:g}", value); sprintf(std_str, "%g", static_cast<double>(value)); CHECK_EQ(str, std_str);
-        usf::format_to(str, 128, "{:G}", value); sprintf(std_str, "%G", static_cast<double>(value)); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{:.6g}", value); sprintf(std_str, "%g", static_cast<double>(value)); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{:.6G}", value); sprintf(std_str, "%G", static_cast<double>(value)); CHECK_EQ(str, std_str);
 
         value = -123.456789f;
 
-        usf::format_to(str, 128, "{}",   value); sprintf(std_str, "%g", static_cast<double>(value)); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{}",   value); CHECK_EQ(str, "-123.45679");
         usf::format_to(str, 128, "{:f}", value); sprintf(std_str, "%f", static_cast<double>(value)); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:F}", value); sprintf(std_str, "%F", static_cast<double>(value)); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:e}", value); sprintf(std_str, "%e", static_cast<double>(value)); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:E}", value); sprintf(std_str, "%E", static_cast<double>(value)); CHECK_EQ(str, std_str);
-        usf::format_to(str, 128, "{:g}", value); sprintf(std_str, "%g", static_cast<double>(value)); CHECK_EQ(str, std_str);
-        usf::format_to(str, 128, "{:G}", value); sprintf(std_str, "%G", static_cast<double>(value)); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{:.6g}", value); sprintf(std_str, "%g", static_cast<double>(value)); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{:.6G}", value); sprintf(std_str, "%G", static_cast<double>(value)); CHECK_EQ(str, std_str);
 
         CHECK_THROWS_AS(usf::format_to(str, 128, "{:c}", value), std::runtime_error);
         CHECK_THROWS_AS(usf::format_to(str, 128, "{:d}", value), std::runtime_error);
@@ -449,23 +452,23 @@ TEST_CASE("usf::format_to, basic types")
 
         char std_str[32]{};
 
-        usf::format_to(str, 128, "{}",   value); sprintf(std_str, "%g", value); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{}",   value); CHECK_EQ(str, "123.456789");
         usf::format_to(str, 128, "{:f}", value); sprintf(std_str, "%f", value); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:F}", value); sprintf(std_str, "%F", value); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:e}", value); sprintf(std_str, "%e", value); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:E}", value); sprintf(std_str, "%E", value); CHECK_EQ(str, std_str);
-        usf::format_to(str, 128, "{:g}", value); sprintf(std_str, "%g", value); CHECK_EQ(str, std_str);
-        usf::format_to(str, 128, "{:G}", value); sprintf(std_str, "%G", value); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{:.6g}", value); sprintf(std_str, "%g", value); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{:.6G}", value); sprintf(std_str, "%G", value); CHECK_EQ(str, std_str);
 
         value = -123.456789;
 
-        usf::format_to(str, 128, "{}",   value); sprintf(std_str, "%g", value); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{}",   value); CHECK_EQ(str, "-123.456789");
         usf::format_to(str, 128, "{:f}", value); sprintf(std_str, "%f", value); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:F}", value); sprintf(std_str, "%F", value); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:e}", value); sprintf(std_str, "%e", value); CHECK_EQ(str, std_str);
         usf::format_to(str, 128, "{:E}", value); sprintf(std_str, "%E", value); CHECK_EQ(str, std_str);
-        usf::format_to(str, 128, "{:g}", value); sprintf(std_str, "%g", value); CHECK_EQ(str, std_str);
-        usf::format_to(str, 128, "{:G}", value); sprintf(std_str, "%G", value); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{:.6g}", value); sprintf(std_str, "%g", value); CHECK_EQ(str, std_str);
+        usf::format_to(str, 128, "{:.6G}", value); sprintf(std_str, "%G", value); CHECK_EQ(str, std_str);
 
         CHECK_THROWS_AS(usf::format_to(str, 128, "{:c}", value), std::runtime_error);
         CHECK_THROWS_AS(usf::format_to(str, 128, "{:d}", value), std::runtime_error);
@@ -565,4 +568,471 @@ TEST_CASE("usf::format_to, basic types")
     }
 }
 
+// ----------------------------------------------------------------------------
+// INTEGER CONVERSION
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::format_to, integer conversion")
+{
+    char usf_str[128]{};
+    char std_str[128]{};
+
+    // Decimal conversion around every power of 10 boundary (all digit counts)
+    {
+        uint64_t pow10 = 1;
+
+        for(int i = 0; i < 20; ++i)
+        {
+            const uint64_t values[]{pow10 - 1, pow10, pow10 + 1, pow10 + pow10 / 2};
+
+            for(const auto value : values)
+            {
+                usf::format_to(usf_str, 128, "{}", value);
+                sprintf(std_str, "%llu", static_cast<unsigned long long>(value));
+                CHECK_EQ(usf_str, std_str);
+            }
+
+            if(i < 19) { pow10 *= 10; }
+        }
+
+        usf::format_to(usf_str, 128, "{}", UINT32_MAX); CHECK_EQ(usf_str, "4294967295");
+        usf::format_to(usf_str, 128, "{}", UINT64_MAX); CHECK_EQ(usf_str, "18446744073709551615");
+        usf::format_to(usf_str, 128, "{}", INT64_MIN + 1); CHECK_EQ(usf_str, "-9223372036854775807");
+    }
+
+    // Digit count of all bases at every bit width boundary
+    {
+        using usf::internal::Integer;
+
+        for(int bits = 0; bits < 64; ++bits)
+        {
+            const uint64_t values[]{(UINT64_C(1) << bits) - 1, UINT64_C(1) << bits, (UINT64_C(1) << bits) + 1};
+
+            for(const auto value : values)
+            {
+                const auto v = static_cast<unsigned long long>(value);
+
+                CHECK_EQ(Integer::count_digits_dec(value), sprintf(std_str, "%llu", v));
+                CHECK_EQ(Integer::count_digits_hex(value), sprintf(std_str, "%llx", v));
+                CHECK_EQ(Integer::count_digits_oct(value), sprintf(std_str, "%llo", v));
+                CHECK_EQ(Integer::count_digits_bin(value), usf::format_to(usf_str, 128, "{:b}", value) - usf_str);
+
+                if(value <= UINT32_MAX)
+                {
+                    const auto value32 = static_cast<uint32_t>(value);
+
+                    CHECK_EQ(Integer::count_digits_dec(value32), sprintf(std_str, "%llu", v));
+                    CHECK_EQ(Integer::count_digits_hex(value32), sprintf(std_str, "%llx", v));
+                    CHECK_EQ(Integer::count_digits_oct(value32), sprintf(std_str, "%llo", v));
+                    CHECK_EQ(Integer::count_digits_bin(value32), Integer::count_digits_bin(value));
+                }
+            }
+        }
+    }
+
+    // Small integer types (every value) against sprintf
+    {
+        for(int32_t i = 0; i <= UINT16_MAX; ++i)
+        {
+            const auto u16 = static_cast<uint16_t>(i);
+            const auto i16 = static_cast<int16_t>(u16);
+
+            usf::format_to(usf_str, 128, "{}|{}|{:5}|{:<6d}|{:x}", u16, i16, u16, i16, u16);
+            sprintf(std_str, "%u|%d|%5u|%-6d|%x", u16, i16, u16, i16, u16);
+            CHECK_EQ(usf_str, std_str);
+
+            if(i <= UINT8_MAX)
+            {
+                const auto u8 = static_cast<uint8_t>(i);
+                const auto i8 = static_cast<int8_t>(u8);
+
+                usf::format_to(usf_str, 128, "{}|{}|{:4}|{:+d}", u8, i8, u8, i8);
+                sprintf(std_str, "%u|%d|%4u|%+d", u8, i8, u8, i8);
+                CHECK_EQ(usf_str, std_str);
+            }
+        }
+
+        // Lookup table conversion with no room for the 4 byte store
+        char small_str[4]{};
+        usf::format_to(small_str, 3, "{}", static_cast<uint8_t>(7)); CHECK_EQ(small_str, "7");
+        usf::format_to(small_str, 3, "{}", static_cast<uint8_t>(42)); CHECK_EQ(small_str, "42");
+        usf::format_to(small_str, 4, "{}", static_cast<uint8_t>(255)); CHECK_EQ(small_str, "255");
+    }
+
+    // Word parallel (SWAR) binary, octal and hexadecimal conversion
+    {
+        auto reference_bin = [](char* str, uint64_t value)
+        {
+            char tmp[65]{};
+            int i = 64;
+
+            do { tmp[--i] = static_cast<char>('0' + (value & 1U)); value >>= 1U; } while(value != 0);
+
+            std::strcpy(str, tmp + i);
+        };
+
+        std::mt19937_64 rng(54321);
+
+        for(int i = 0; i < 10000; ++i)
+        {
+            const uint64_t value = rng() >> (rng() % 64);
+            const auto v = static_cast<unsigned long long>(value);
+
+            usf::format_to(usf_str, 128, "{:x}|{:X}|{:o}|{:b}", value, value, value, value);
+
+            char bin_str[65]{};
+            reference_bin(bin_str, value);
+
+            sprintf(std_str, "%llx|%llX|%llo|%s", v, v, v, bin_str);
+            CHECK_EQ(usf_str, std_str);
+
+            const auto value32 = static_cast<uint32_t>(value);
+
+            usf::format_to(usf_str, 128, "{:x}|{:X}|{:o}|{:b}", value32, value32, value32, value32);
+
+            reference_bin(bin_str, value32);
+
+            sprintf(std_str, "%x|%X|%o|%s", value32, value32, value32, bin_str);
+            CHECK_EQ(usf_str, std_str);
+        }
+    }
+
+#if !defined(USF_DISABLE_RADIX_SUPPORT)
+    // Arbitrary radix conversion of every base against a reference conversion
+    {
+        const char* digits = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+        std::mt19937_64 rng(62);
+
+        for(unsigned base = 2; base <= 62; ++base)
+        {
+            char fmt[16]{};
+            usf::format_to(fmt, 16, "{{:r{}}}", base);
+
+            for(int i = 0; i < 200; ++i)
+            {
+                const uint64_t value = (i == 0) ? 0 : (i == 1) ? UINT64_MAX : rng() >> (rng() % 64);
+
+                char ref_str[72]{};
+                char* it = ref_str + 71;
+                uint64_t v = value;
+
+                do { *(--it) = digits[v % base]; v /= base; } while(v != 0);
+
+                usf::format_to(usf_str, 128, fmt, value);
+                CHECK_EQ(usf_str, it);
+
+                if(value <= UINT32_MAX)
+                {
+                    usf::format_to(usf_str, 128, fmt, static_cast<uint32_t>(value));
+                    CHECK_EQ(usf_str, it);
+                }
+            }
+        }
+    }
+#endif
+
+#if defined(USF_INT128_SUPPORT)
+    // 128 bit integer conversion against a digit by digit reference conversion
+    {
+        auto reference = [](char* str, usf::uint128_t value, const unsigned base)
+        {
+            char tmp[130]{};
+            int i = 129;
+
+            do
+            {
+                tmp[--i] = "0123456789abcdef"[static_cast<unsigned>(value % base)];
+                value /= base;
+            } while(value != 0);
+
+            std::strcpy(str, tmp + i);
+        };
+
+        auto check = [&](const usf::uint128_t value)
+        {
+            char ref_dec[48]{}, ref_hex[40]{}, ref_oct[48]{}, ref_bin[130]{};
+
+            reference(ref_dec, value, 10);
+            reference(ref_hex, value, 16);
+            reference(ref_oct, value, 8);
+            reference(ref_bin, value, 2);
+
+            char usf_str128[256]{};
+            char ref_str128[256]{};
+
+            usf::format_to(usf_str128, 256, "{}|{:x}|{:o}|{:b}", value, value, value, value);
+            sprintf(ref_str128, "%s|%s|%s|%s", ref_dec, ref_hex, ref_oct, ref_bin);
+            CHECK_EQ(usf_str128, ref_str128);
+
+#if !defined(USF_DISABLE_RADIX_SUPPORT)
+            char ref_radix[48]{};
+            reference(ref_radix, value, 7);
+
+            usf::format_to(usf_str128, 256, "{:r7}", value);
+            CHECK_EQ(usf_str128, ref_radix);
+#endif
+
+            CHECK_EQ(usf::internal::Integer::count_digits_dec(value), static_cast<int>(std::strlen(ref_dec)));
+        };
+
+        // Every power of 10 boundary
+        usf::uint128_t pow10 = 1;
+
+        for(int i = 0; i < 39; ++i)
+        {
+            check(pow10 - 1);
+            check(pow10);
+            check(pow10 + 1);
+
+            if(i < 38) { pow10 *= 10; }
+        }
+
+        const usf::uint128_t uint128_max = ~static_cast<usf::uint128_t>(0);
+        const usf::int128_t  int128_max  = static_cast<usf::int128_t>(uint128_max >> 1U);
+        const usf::int128_t  int128_min  = -int128_max - 1;
+
+        check(uint128_max);
+
+        usf::format_to(usf_str, 128, "{}|{}", int128_max, int128_min);
+        CHECK_EQ(usf_str, "170141183460469231731687303715884105727|-170141183460469231731687303715884105728");
+
+        usf::format_to(usf_str, 128, "{:#X}|{:+d}|{:>6}", uint128_max, static_cast<usf::int128_t>(-1), static_cast<usf::uint128_t>(42));
+        CHECK_EQ(usf_str, "0XFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF|-1|    42");
+
+        usf::format_to(usf_str, 128, "{:.42d}|{:036x}", int128_min, uint128_max);
+        CHECK_EQ(usf_str, "-000170141183460469231731687303715884105728|0000ffffffffffffffffffffffffffffffff");
+
+        std::mt19937_64 rng(128);
+
+        for(int i = 0; i < 2000; ++i)
+        {
+            const usf::uint128_t value = ((static_cast<usf::uint128_t>(rng()) << 64U) | rng()) >> (rng() % 128);
+            check(value);
+        }
+    }
+
+    // Arbitrary precision integer conversion against a digit by digit reference conversion
+    {
+        static char usf_big[2600]{};
+        static char ref_big[2600]{};
+
+        auto reference = [](char* str, const uint64_t* limbs, const int count, const unsigned base)
+        {
+            uint64_t value[128]{};
+            std::copy(limbs, limbs + count, value);
+
+            int n = count;
+            int i = 2599;
+            str[i] = '\0';
+
+            do
+            {
+                usf::uint128_t r = 0;
+
+                for(int j = n - 1; j >= 0; --j)
+                {
+                    const usf::uint128_t v = (r << 64U) | value[j];
+                    value[j] = static_cast<uint64_t>(v / base);
+                    r = v % base;
+                }
+
+                str[--i] = "0123456789abcdef"[static_cast<unsigned>(r)];
+
+                while(n > 0 && value[n - 1] == 0) { --n; }
+            } while(n > 0);
+
+            std::memmove(str, str + i, static_cast<std::size_t>(2600 - i));
+        };
+
+        auto check = [&](const uint64_t* limbs, const int count)
+        {
+            const usf::BigIntView value(limbs, static_cast<std::size_t>(count));
+
+            reference(ref_big, limbs, count, 10);
+            usf::format_to(usf_big, 2600, "{}", value);
+            CHECK_EQ(usf_big, ref_big);
+
+            reference(ref_big, limbs, count, 16);
+            usf::format_to(usf_big, 2600, "{:x}", value);
+            CHECK_EQ(usf_big, ref_big);
+        };
+
+        const uint64_t uint256_max_limbs[4]{ UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX };
+        const usf::BigIntView uint256_max(uint256_max_limbs);
+
+        usf::format_to(usf_big, 2600, "{}", uint256_max);
+        CHECK_EQ(usf_big, "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+
+        usf::format_to(usf_big, 2600, "{:#X}|{:b}", uint256_max, usf::BigIntView(uint256_max_limbs, 1));
+        CHECK_EQ(usf_big, "0XFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF|"
+                          "1111111111111111111111111111111111111111111111111111111111111111");
+
+        // 10^38 = 0x4B3B4CA85A86C47A098A224000000000
+        const uint64_t pow10_38[3]{ UINT64_C(0x098A224000000000), UINT64_C(0x4B3B4CA85A86C47A), 0 };
+
+        usf::format_to(usf_big, 2600, "{}|{:>45}|{:<42}|{:+d}|{}",
+                       usf::BigIntView(pow10_38, 3, true), usf::BigIntView(pow10_38, 3, true),
+                       usf::BigIntView(pow10_38), usf::BigIntView(pow10_38), usf::BigIntView(pow10_38 + 2, 1, true));
+        CHECK_EQ(usf_big, "-100000000000000000000000000000000000000|"
+                          "     -100000000000000000000000000000000000000|"
+                          "100000000000000000000000000000000000000   |"
+                          "+100000000000000000000000000000000000000|0");
+
+        usf::format_to(usf_big, 2600, "{:.42d}|{:#036x}", usf::BigIntView(pow10_38, 3, true), usf::BigIntView(pow10_38));
+        CHECK_EQ(usf_big, "-000100000000000000000000000000000000000000|0x004b3b4ca85a86c47a098a224000000000");
+
+        CHECK_THROWS_AS(usf::format_to(usf_big, 2600, "{:,}", uint256_max), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(usf_big, 2600, "{:o}", uint256_max), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(usf_big, 40, "{}", uint256_max), std::runtime_error);
+
+        // Only the actual digits need to fit in the output string
+        const uint64_t five[1]{ 5 };
+        char usf_small[16]{};
+        usf::format_to(usf_small, 16, "{}", usf::BigIntView(five));
+        CHECK_EQ(usf_small, "5");
+
+        usf::format_to(usf_big, 79, "{}", uint256_max);
+        CHECK_EQ(usf_big, "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+        CHECK_THROWS_AS(usf::format_to(usf_big, 78, "{}", uint256_max), std::runtime_error);
+
+        // Random values of all the supported sizes (1 to USF_BIGINT_MAX_LIMBS
+        // limbs), with long runs of zero and all-ones bits in the limbs.
+        std::mt19937_64 rng(8192);
+
+        uint64_t limbs[USF_BIGINT_MAX_LIMBS + 1]{};
+
+        for(int count = 1; count <= USF_BIGINT_MAX_LIMBS; ++count)
+        {
+            for(int i = 0; i < 4; ++i)
+            {
+                for(int j = 0; j < count; ++j)
+                {
+                    const uint64_t r = rng();
+
+                    switch(r % 4)
+                    {
+                        case 0:  limbs[j] = 0;          break;
+                        case 1:  limbs[j] = UINT64_MAX; break;
+                        default: limbs[j] = rng();      break;
+                    }
+                }
+
+                limbs[count - 1] |= 1;
+
+                check(limbs, count);
+            }
+        }
+
+        // Larger values are rejected
+        limbs[USF_BIGINT_MAX_LIMBS] = 1;
+        CHECK_THROWS_AS(usf::format_to(usf_big, 2600, "{}", usf::BigIntView(limbs, USF_BIGINT_MAX_LIMBS + 1)), std::runtime_error);
+    }
+#endif
+
+#if defined(USF_SIMD_SSE2)
+    // Vectorized (SSE2) decimal conversion against the scalar conversion
+    {
+        auto check_sse2 = [](const uint64_t value)
+        {
+            char sse2_str[24]{};
+            char scalar_str[24]{};
+
+            const auto digits = usf::internal::Integer::count_digits_dec(value);
+
+            usf::internal::Integer::convert_dec_sse2(sse2_str + digits, value);
+            usf::internal::Integer::convert_dec_scalar(scalar_str + digits, value);
+
+            CHECK_EQ(sse2_str, scalar_str);
+        };
+
+        const uint64_t edge_values[]
+        {
+            100000000U, 100000001U, 999999999U, 4294967295U, 4294967296U,
+            9999999999999999U, 10000000000000000U, 10000000000000001U,
+            99999999999999999U, 10000000000000000000U, 18446744073709551615U
+        };
+
+        for(const auto value : edge_values) { check_sse2(value); }
+
+        std::mt19937_64 rng(12345);
+
+        for(int i = 0; i < 10000; ++i)
+        {
+            // Random values with random lengths (the vectorized
+            // conversion is only used for values with 9+ digits).
+            const uint64_t value = rng() >> (rng() % 36);
+
+            if(value >= 100000000U) { check_sse2(value); }
+        }
+    }
+#endif
+}
+
+TEST_CASE("usf::format_to, decimal conversion")
+{
+    char usf_str[128]{};
+
+    // Natural number of decimals
+    usf::format_to(usf_str, 128, "{}", usf::Decimal(12345, -2));          CHECK_EQ(usf_str, std::string("123.45"));
+    usf::format_to(usf_str, 128, "{}", usf::Decimal(-5, -3));             CHECK_EQ(usf_str, std::string("-0.005"));
+    usf::format_to(usf_str, 128, "{}", usf::Decimal(0, -2));              CHECK_EQ(usf_str, std::string("0.00"));
+    usf::format_to(usf_str, 128, "{}", usf::Decimal(42));                 CHECK_EQ(usf_str, std::string("42"));
+    usf::format_to(usf_str, 128, "{}", usf::Decimal(42, 3));              CHECK_EQ(usf_str, std::string("42000"));
+    usf::format_to(usf_str, 128, "{:f}", usf::Decimal(1, -20));           CHECK_EQ(usf_str, std::string("0.00000000000000000001"));
+    usf::format_to(usf_str, 128, "{}", usf::Decimal(INT64_MIN, -4));      CHECK_EQ(usf_str, std::string("-922337203685477.5808"));
+
+    // Rounding (half away from zero)
+    usf::format_to(usf_str, 128, "{:.2f}", usf::Decimal(2675, -3));       CHECK_EQ(usf_str, std::string("2.68"));
+    usf::format_to(usf_str, 128, "{:.2f}", usf::Decimal(2665, -3));       CHECK_EQ(usf_str, std::string("2.67"));
+    usf::format_to(usf_str, 128, "{:.2f}", usf::Decimal(-2675, -3));      CHECK_EQ(usf_str, std::string("-2.68"));
+    usf::format_to(usf_str, 128, "{:.2f}", usf::Decimal(26749, -4));      CHECK_EQ(usf_str, std::string("2.67"));
+    usf::format_to(usf_str, 128, "{:.0f}", usf::Decimal(999, -3));        CHECK_EQ(usf_str, std::string("1"));
+    usf::format_to(usf_str, 128, "{:.1f}", usf::Decimal(-4, -2));         CHECK_EQ(usf_str, std::string("-0.0"));
+    usf::format_to(usf_str, 128, "{:.1f}", usf::Decimal(INT64_MAX, -40)); CHECK_EQ(usf_str, std::string("0.0"));
+    usf::format_to(usf_str, 128, "{:.0f}", usf::Decimal(INT64_C(4999999999999999999), -19)); CHECK_EQ(usf_str, std::string("0"));
+
+    // Padding with zeros
+    usf::format_to(usf_str, 128, "{:.4f}", usf::Decimal(12345, -2));      CHECK_EQ(usf_str, std::string("123.4500"));
+    usf::format_to(usf_str, 128, "{:.2f}", usf::Decimal(7, 2));           CHECK_EQ(usf_str, std::string("700.00"));
+    usf::format_to(usf_str, 128, "{:.3f}", usf::Decimal(5, -2));          CHECK_EQ(usf_str, std::string("0.050"));
+    usf::format_to(usf_str, 128, "{:#.0f}", usf::Decimal(5));             CHECK_EQ(usf_str, std::string("5."));
+
+    // Format spec options
+    usf::format_to(usf_str, 128, "{:+,.2f}", usf::Decimal(123456789, -2));  CHECK_EQ(usf_str, std::string("+1,234,567.89"));
+    usf::format_to(usf_str, 128, "{:,}", usf::Decimal(1, 6));              CHECK_EQ(usf_str, std::string("1,000,000"));
+    usf::format_to(usf_str, 128, "{:>10}", usf::Decimal(-150, -2));         CHECK_EQ(usf_str, std::string("     -1.50"));
+    usf::format_to(usf_str, 128, "{:*^10.1f}", usf::Decimal(15, -1));       CHECK_EQ(usf_str, std::string("***1.5****"));
+    usf::format_to(usf_str, 128, "{:08.2f}", usf::Decimal(-150, -2));       CHECK_EQ(usf_str, std::string("-0001.50"));
+
+    CHECK_THROWS_AS(usf::format_to(usf_str, 128, "{:e}", usf::Decimal(1)), std::runtime_error);
+    CHECK_THROWS_AS(usf::format_to(usf_str, 128, "{:d}", usf::Decimal(1)), std::runtime_error);
+    CHECK_THROWS_AS(usf::format_to(usf_str, 8, "{}", usf::Decimal(1, -10)), std::runtime_error);
+
+    // Random values against the integer conversion (exact)
+    std::mt19937_64 rng(13579);
+
+    for(int i = 0; i < 10000; ++i)
+    {
+        const auto mantissa = static_cast<int64_t>(rng() >> (rng() % 64));
+        const auto scale = static_cast<int>(rng() % 10);
+
+        char std_str[128]{};
+
+        const uint64_t pow10 = usf::internal::Integer::pow10_uint64(scale);
+        const uint64_t magnitude = (mantissa < 0) ? 0 - static_cast<uint64_t>(mantissa) : static_cast<uint64_t>(mantissa);
+
+        if(scale == 0)
+        {
+            sprintf(std_str, "%s%" PRIu64, (mantissa < 0) ? "-" : "", magnitude);
+        }
+        else
+        {
+            sprintf(std_str, "%s%" PRIu64 ".%0*" PRIu64, (mantissa < 0) ? "-" : "", magnitude / pow10, scale, magnitude % pow10);
+        }
+
+        usf::format_to(usf_str, 128, "{}", usf::Decimal(mantissa, static_cast<int8_t>(-scale)));
+        CHECK_EQ(usf_str, std::string(std_str));
+    }
+}
+
 #endif // #if defined(USF_TEST_BASIC_TYPES)
@@ -4,6 +4,7 @@
 #if defined(USF_TEST_BENCHMARKS)
 
 #include <chrono>
+#include <random>
 
 #if defined(USF_TEST_BENCHMARK_FMT)
 #define FMT_HEADER_ONLY
@@ -19,22 +20,31 @@ TEST_CASE("usf::format_to, benchmark")
     auto ms_min_usf1 = std::numeric_limits<int64_t>::max();
     auto ms_min_usf2 = std::numeric_limits<int64_t>::max();
     auto ms_min_usf3 = std::numeric_limits<int64_t>::max();
+    auto ms_min_usf4 = std::numeric_limits<int64_t>::max();
 
 #if defined(USF_TEST_BENCHMARK_PRINTF)
     auto ms_min_std1 = std::numeric_limits<int64_t>::max();
     auto ms_min_std2 = std::numeric_limits<int64_t>::max();
     auto ms_min_std3 = std::numeric_limits<int64_t>::max();
+    auto ms_min_std4 = std::numeric_limits<int64_t>::max();
 #endif
 
 #if defined(USF_TEST_BENCHMARK_FMT)
     auto ms_min_fmt1 = std::numeric_limits<int64_t>::max();
     auto ms_min_fmt2 = std::numeric_limits<int64_t>::max();
     auto ms_min_fmt3 = std::numeric_limits<int64_t>::max();
+    auto ms_min_fmt4 = std::numeric_limits<int64_t>::max();
 #endif
 
     const int max_runs = 10;
     const int max_iterations = 2000000;
 
+    // 64 bit decimal values with different number of digits
+    const uint64_t dec64_1 = __UINT64_MAX__;
+    const uint64_t dec64_2 = 1234567890123456789U;
+    const uint64_t dec64_3 = 98765432109876U;
+    const uint64_t dec64_4 = 5000000000U;
+
     for(int r = 0; r < max_runs; ++r)
     {
         std::cout << "TESTRUN: " << r << '\n';
@@ -171,15 +181,223 @@ TEST_CASE("usf::format_to, benchmark")
             ms_min_fmt3 = std::min(ms_min_fmt3, ms);
         }
 #endif
+
+        // uSF usf::format_to
+        {
+            char str[128]{};
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                usf::format_to(str, 128, "{:d}|{:d}|{:d}|{:d}", dec64_1, dec64_2, dec64_3, dec64_4);
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "usf:: " << str << " -> " << ms << "ms\n";
+            ms_min_usf4 = std::min(ms_min_usf4, ms);
+        }
+#if defined(USF_TEST_BENCHMARK_PRINTF)
+        // Standard sprintf
+        {
+            char str[128]{};
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+#if (__LONG_MAX__ != __LONG_LONG_MAX__)
+                sprintf(str, "%llu|%llu|%llu|%llu", dec64_1, dec64_2, dec64_3, dec64_4);
+#else
+                sprintf(str, "%lu|%lu|%lu|%lu", dec64_1, dec64_2, dec64_3, dec64_4);
+#endif
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "std:: " << str << " -> " << ms << "ms\n";
+            ms_min_std4 = std::min(ms_min_std4, ms);
+        }
+#endif
+#if defined(USF_TEST_BENCHMARK_FMT)
+        // {fmt} fmt::format_to
+        {
+            char str[128]{};
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                auto res = fmt::format_to(str, "{:d}|{:d}|{:d}|{:d}", dec64_1, dec64_2, dec64_3, dec64_4);
+                *res = '\0';
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "fmt:: " << str << " -> " << ms << "ms\n";
+            ms_min_fmt4 = std::min(ms_min_fmt4, ms);
+        }
+#endif
     }
 
     std::cout << "BEST RESULTS:\n";
-    std::cout << "USF:  " << ms_min_usf1 << "ms / " << ms_min_usf2 << "ms / " << ms_min_usf3 << "ms\n";
+    std::cout << "USF:  " << ms_min_usf1 << "ms / " << ms_min_usf2 << "ms / " << ms_min_usf3 << "ms / " << ms_min_usf4 << "ms\n";
 #if defined(USF_TEST_BENCHMARK_PRINTF)
-    std::cout << "STD: " << ms_min_std1 << "ms / " << ms_min_std2 << "ms / " << ms_min_std3 << "ms\n";
+    std::cout << "STD: " << ms_min_std1 << "ms / " << ms_min_std2 << "ms / " << ms_min_std3 << "ms / " << ms_min_std4 << "ms\n";
 #endif
 #if defined(USF_TEST_BENCHMARK_FMT)
-    std::cout << "FMT: " << ms_min_fmt1 << "ms / " << ms_min_fmt2 << "ms / " << ms_min_fmt3 << "ms\n";
+    std::cout << "FMT: " << ms_min_fmt1 << "ms / " << ms_min_fmt2 << "ms / " << ms_min_fmt3 << "ms / " << ms_min_fmt4 << "ms\n";
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// BENCHMARK (RANDOM LENGTH INTEGERS)
+// ----------------------------------------------------------------------------
+// Integers with random number of digits defeat the branch prediction of any
+// digit counting and conversion loops that depend on the value length.
+TEST_CASE("usf::format_to, benchmark random length integers")
+{
+    auto ms_min_usf = std::numeric_limits<int64_t>::max();
+
+#if defined(USF_TEST_BENCHMARK_PRINTF)
+    auto ms_min_std = std::numeric_limits<int64_t>::max();
+#endif
+
+    const int max_runs = 10;
+    const int max_iterations = 500;
+
+    uint32_t values32[1024]{};
+    uint64_t values64[1024]{};
+
+    std::mt19937_64 rng(2019);
+
+    for(int i = 0; i < 1024; ++i)
+    {
+        values32[i] = static_cast<uint32_t>(rng() >> (32 + rng() % 32));
+        values64[i] = rng() >> (rng() % 64);
+    }
+
+    for(int r = 0; r < max_runs; ++r)
+    {
+        std::cout << "TESTRUN: " << r << '\n';
+
+        // uSF usf::format_to
+        {
+            char str[128]{};
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                for(int v = 0; v < 1024; ++v)
+                {
+                    usf::format_to(str, 128, "{}|{:x}|{:o}|{}|{:x}", values32[v], values32[v], values32[v], values64[v], values64[v]);
+                }
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "usf:: " << str << " -> " << ms << "ms\n";
+            ms_min_usf = std::min(ms_min_usf, ms);
+        }
+#if defined(USF_TEST_BENCHMARK_PRINTF)
+        // Standard sprintf
+        {
+            char str[128]{};
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                for(int v = 0; v < 1024; ++v)
+                {
+#if (__LONG_MAX__ != __LONG_LONG_MAX__)
+                    sprintf(str, "%u|%x|%o|%llu|%llx", values32[v], values32[v], values32[v], values64[v], values64[v]);
+#else
+                    sprintf(str, "%u|%x|%o|%lu|%lx", values32[v], values32[v], values32[v], values64[v], values64[v]);
+#endif
+                }
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "std:: " << str << " -> " << ms << "ms\n";
+            ms_min_std = std::min(ms_min_std, ms);
+        }
+#endif
+    }
+
+    std::cout << "BEST RESULTS:\n";
+    std::cout << "USF: " << ms_min_usf << "ms\n";
+#if defined(USF_TEST_BENCHMARK_PRINTF)
+    std::cout << "STD: " << ms_min_std << "ms\n";
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// BENCHMARK (SHORTEST ROUND TRIP FLOATING POINT)
+// ----------------------------------------------------------------------------
+// The shortest round trip conversion ({}) against the fixed precision general
+// format ({:.6g}) and the usual printf round trip alternative ("%.17g").
+TEST_CASE("usf::format_to, benchmark shortest floating point")
+{
+    auto ms_min_usf_shortest = std::numeric_limits<int64_t>::max();
+    auto ms_min_usf_general  = std::numeric_limits<int64_t>::max();
+
+#if defined(USF_TEST_BENCHMARK_PRINTF)
+    auto ms_min_std = std::numeric_limits<int64_t>::max();
+#endif
+
+    const int max_runs = 10;
+    const int max_iterations = 500;
+
+    double values[1024]{};
+
+    std::mt19937_64 rng(2019);
+    std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+
+    for(auto& value : values) { value = distribution(rng); }
+
+    for(int r = 0; r < max_runs; ++r)
+    {
+        std::cout << "TESTRUN: " << r << '\n';
+
+        // uSF usf::format_to (shortest)
+        {
+            char str[128]{};
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                for(const auto value : values)
+                {
+                    usf::format_to(str, 128, "{}", value);
+                }
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "usf:: " << str << " -> " << ms << "ms\n";
+            ms_min_usf_shortest = std::min(ms_min_usf_shortest, ms);
+        }
+
+        // uSF usf::format_to (general format)
+        {
+            char str[128]{};
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                for(const auto value : values)
+                {
+                    usf::format_to(str, 128, "{:.6g}", value);
+                }
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "usf:: " << str << " -> " << ms << "ms\n";
+            ms_min_usf_general = std::min(ms_min_usf_general, ms);
+        }
+#if defined(USF_TEST_BENCHMARK_PRINTF)
+        // Standard sprintf
+        {
+            char str[128]{};
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                for(const auto value : values)
+                {
+                    sprintf(str, "%.17g", value);
+                }
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "std:: " << str << " -> " << ms << "ms\n";
+            ms_min_std = std::min(ms_min_std, ms);
+        }
+#endif
+    }
+
+    std::cout << "BEST RESULTS:\n";
+    std::cout << "USF (shortest): " << ms_min_usf_shortest << "ms\n";
+    std::cout << "USF (general) : " << ms_min_usf_general << "ms\n";
+#if defined(USF_TEST_BENCHMARK_PRINTF)
+    std::cout << "STD (%.17g)   : " << ms_min_std << "ms\n";
 #endif
 }
 
@@ -0,0 +1,58 @@
+
+// Built with the compact engine. The other translation units use the default
+// (fast) one, so this also checks that both engines live in the same program.
+#define USF_FLOAT_ENGINE compact
+
+#include "unit_tests_config.hpp"
+
+#if defined(USF_TEST_FLOATING_POINT)
+
+#include <cstdlib>
+#include <random>
+
+// ----------------------------------------------------------------------------
+// FLOATING POINT CONVERSION ENGINE
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::format_to, compact engine floating point conversion")
+{
+    char usf_str[128]{};
+    char std_str[128]{};
+
+    usf::format_to(usf_str, 128, "{}", 0.1);                    CHECK_EQ(usf_str, std::string("0.1"));
+    usf::format_to(usf_str, 128, "{}", 0.1 + 0.2);              CHECK_EQ(usf_str, std::string("0.30000000000000004"));
+    usf::format_to(usf_str, 128, "{}", 5e-324);                 CHECK_EQ(usf_str, std::string("5e-324"));
+    usf::format_to(usf_str, 128, "{}", 1.7976931348623157e308); CHECK_EQ(usf_str, std::string("1.7976931348623157e+308"));
+    usf::format_to(usf_str, 128, "{:.2f}", 0.125);              CHECK_EQ(usf_str, std::string("0.12"));
+
+    // Random bit patterns (all the exponent range): shortest round trip and
+    // fixed precision against printf
+    std::mt19937_64 rng(4321);
+
+    for(int i = 0; i < 20000; ++i)
+    {
+        const uint64_t bits = rng() & ~(UINT64_C(1) << 63U);
+        double value = 0;
+
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if(!std::isfinite(value)) { continue; }
+
+        usf::format_to(usf_str, 128, "{}", value);
+
+        const double parsed = std::strtod(usf_str, nullptr);
+        CHECK_EQ(std::memcmp(&parsed, &value, sizeof(value)), 0);
+
+        sprintf(std_str, "%.17e", value);
+        usf::format_to(usf_str, 128, "{:.17e}", value);
+        CHECK_EQ(usf_str, std_str);
+
+        if(value < 1e30)
+        {
+            sprintf(std_str, "%.12f", value);
+            usf::format_to(usf_str, 128, "{:.12f}", value);
+            CHECK_EQ(usf_str, std_str);
+        }
+    }
+}
+
+#endif // defined(USF_TEST_FLOATING_POINT)
@@ -3,10 +3,13 @@
 
 #if defined(USF_TEST_FLOATING_POINT)
 
+#include <cstdlib>
+#include <random>
+
 // ----------------------------------------------------------------------------
 // FLOATING POINT CONVERSION
 // ----------------------------------------------------------------------------
-void test_float_convertion(const double value)
+static void test_float_convertion(const double value)
 {
     const char types[]{'f', 'e', 'g'};
 
@@ -17,11 +20,14 @@ void test_float_convertion(const double value)
             char std_str[64]{};
             char usf_str[64]{};
 
-            char std_fmt[8]{};
             char usf_fmt[8]{};
 
-            sprintf(std_fmt, "%%.%d%c", p, types[t]);
-            sprintf(std_str, std_fmt, value);
+            switch(types[t])
+            {
+                case 'f': sprintf(std_str, "%.*f", p, value); break;
+                case 'e': sprintf(std_str, "%.*e", p, value); break;
+                default : sprintf(std_str, "%.*g", p, value); break;
+            }
 
             usf::format_to(usf_fmt, 8, "{{:.{:d}{:c}}}", p, types[t]);
             usf::format_to(usf_str, 64, usf_fmt, value);
@@ -32,7 +38,7 @@ void test_float_convertion(const double value)
 #if 0
             if(!result_ok)
             {
-                printf("ERROR: %.20f, %s usf: %s || std %s\n", value, std_fmt, usf_str, std_str);
+                printf("ERROR: %.20f, %s usf: %s || std %s\n", value, usf_fmt, usf_str, std_str);
                 usf::format_to(usf_str, 64, usf_fmt, value);
             }
 #endif
@@ -124,4 +130,600 @@ TEST_CASE("usf::format_to, floating point conversion")
     }
 }
 
+TEST_CASE("usf::format_to, shortest floating point conversion")
+{
+    char usf_str[64]{};
+    char std_str[64]{};
+
+    auto same_value = [](const double a, const double b)
+    {
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    };
+
+    // Round trip: the output parses back to the same value and
+    // no representation with one digit less does the same.
+    auto check_round_trip = [&](const double value)
+    {
+        usf::format_to(usf_str, 64, "{:e}", 0.0); // Clear the string
+        usf::format_to(usf_str, 64, "{}", value);
+
+        CHECK_UNARY(same_value(std::strtod(usf_str, nullptr), value));
+
+        // Significant digits (without leading and trailing zeros)
+        int digits = 0;
+        int nonzero_digits = 0;
+
+        for(const char* it = usf_str; *it != '\0' && *it != 'e'; ++it)
+        {
+            if(*it >= '0' && *it <= '9' && (digits > 0 || *it != '0'))
+            {
+                ++digits;
+
+                if(*it != '0') { nonzero_digits = digits; }
+            }
+        }
+
+        digits = nonzero_digits;
+
+        if(digits > 1)
+        {
+            sprintf(std_str, "%.*e", digits - 2, value);
+            CHECK_UNARY_FALSE(same_value(std::strtod(std_str, nullptr), value));
+        }
+    };
+
+    // Some well known values
+    usf::format_to(usf_str, 64, "{}", 0.1);                    CHECK_EQ(usf_str, std::string("0.1"));
+    usf::format_to(usf_str, 64, "{}", 0.3);                    CHECK_EQ(usf_str, std::string("0.3"));
+    usf::format_to(usf_str, 64, "{}", 0.1 + 0.2);              CHECK_EQ(usf_str, std::string("0.30000000000000004"));
+    usf::format_to(usf_str, 64, "{}", 1.0 / 3.0);              CHECK_EQ(usf_str, std::string("0.3333333333333333"));
+    usf::format_to(usf_str, 64, "{}", 100000.0);               CHECK_EQ(usf_str, std::string("100000"));
+    usf::format_to(usf_str, 64, "{}", 1e15);                   CHECK_EQ(usf_str, std::string("1000000000000000"));
+    usf::format_to(usf_str, 64, "{}", 1e16);                   CHECK_EQ(usf_str, std::string("1e+16"));
+    usf::format_to(usf_str, 64, "{}", 0.0001);                 CHECK_EQ(usf_str, std::string("0.0001"));
+    usf::format_to(usf_str, 64, "{:G}", 0.00001);              CHECK_EQ(usf_str, std::string("1E-05"));
+    usf::format_to(usf_str, 64, "{}", 9007199254740993.0);     CHECK_EQ(usf_str, std::string("9007199254740992"));
+    usf::format_to(usf_str, 64, "{}", 5e-324);                 CHECK_EQ(usf_str, std::string("5e-324"));
+    usf::format_to(usf_str, 64, "{}", 2.2250738585072014e-308);CHECK_EQ(usf_str, std::string("2.2250738585072014e-308"));
+    usf::format_to(usf_str, 64, "{}", 1.7976931348623157e308); CHECK_EQ(usf_str, std::string("1.7976931348623157e+308"));
+    usf::format_to(usf_str, 64, "{}", -1.5e-7);                CHECK_EQ(usf_str, std::string("-1.5e-07"));
+    usf::format_to(usf_str, 64, "{:>12g}", 2.5);               CHECK_EQ(usf_str, std::string("         2.5"));
+    usf::format_to(usf_str, 64, "{:#g}", 2.5);                 CHECK_EQ(usf_str, std::string("2.50000"));
+
+    // Random bit patterns (all the exponent range) and random integers
+    std::mt19937_64 rng(1234);
+
+    for(int i = 0; i < 100000; ++i)
+    {
+        uint64_t bits = rng();
+        double value = 0;
+
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if(std::isfinite(value) && (bits << 1U) != 0) { check_round_trip(value); }
+
+        check_round_trip(static_cast<double>(rng() >> (rng() % 64)) + 1);
+    }
+
+    // Subnormals
+    for(uint64_t bits = 1; bits < (UINT64_C(1) << 52U); bits = bits * 3 + 1)
+    {
+        double value = 0;
+
+        std::memcpy(&value, &bits, sizeof(value));
+
+        check_round_trip(value);
+    }
+}
+
+TEST_CASE("usf::format_to, full range floating point conversion")
+{
+    char usf_str[512]{};
+    char std_str[512]{};
+    char usf_fmt[16]{};
+
+    // Outside the old [1e-19, 1.8446744e19] range (3 digit exponents and subnormals)
+    usf::format_to(usf_str, 512, "{:e}", 1e300);               CHECK_EQ(usf_str, std::string("1.000000e+300"));
+    usf::format_to(usf_str, 512, "{:.3e}", 5e-324);            CHECK_EQ(usf_str, std::string("4.941e-324"));
+    usf::format_to(usf_str, 512, "{:E}", -1.5e-310);           CHECK_EQ(usf_str, std::string("-1.500000E-310"));
+    usf::format_to(usf_str, 512, "{:.3g}", 1.7976931348623157e308); CHECK_EQ(usf_str, std::string("1.8e+308"));
+    usf::format_to(usf_str, 512, "{:>12.2e}", 2.5e100);        CHECK_EQ(usf_str, std::string("   2.50e+100"));
+    usf::format_to(usf_str, 512, "{:.2f}", 1e20);              CHECK_EQ(usf_str, std::string("100000000000000000000.00"));
+    usf::format_to(usf_str, 512, "{:.4f}", 1e-300);            CHECK_EQ(usf_str, std::string("0.0000"));
+
+    // Random bit patterns (all the exponent range) up to 17 significant digits
+    std::mt19937_64 rng(4321);
+
+    for(int i = 0; i < 100000; ++i)
+    {
+        uint64_t bits = rng();
+
+        // Subnormals
+        if(i % 4 == 0) { bits = (bits & UINT64_C(0x800FFFFFFFFFFFFF)) >> (rng() % 52); }
+
+        double value = 0;
+
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if(!std::isfinite(value)) { continue; }
+
+        const int precision = static_cast<int>(rng() % 17);
+
+        sprintf(std_str, "%.*e", precision, value);
+        usf::format_to(usf_fmt, 16, "{{:.{:d}e}}", precision);
+        usf::format_to(usf_str, 512, usf_fmt, value);
+        CHECK_EQ(usf_str, std::string(std_str));
+
+        sprintf(std_str, "%.*g", precision + 1, value);
+        usf::format_to(usf_fmt, 16, "{{:.{:d}g}}", precision + 1);
+        usf::format_to(usf_str, 512, usf_fmt, value);
+        CHECK_EQ(usf_str, std::string(std_str));
+
+        // Fixed point only while all the significant digits are exact
+        if(std::fabs(value) < 1e16 && std::fabs(value) * std::pow(10.0, precision) < 1e16)
+        {
+            sprintf(std_str, "%.*f", precision, value);
+            usf::format_to(usf_fmt, 16, "{{:.{:d}f}}", precision);
+            usf::format_to(usf_str, 512, usf_fmt, value);
+            CHECK_EQ(usf_str, std::string(std_str));
+        }
+    }
+}
+
+TEST_CASE("usf::format_to, exact floating point conversion")
+{
+    static char usf_str[1200]{};
+    static char std_str[1200]{};
+    char usf_fmt[16]{};
+
+    // All the digits of the exact binary value
+    usf::format_to(usf_str, 1200, "{:.20f}", 0.1);             CHECK_EQ(usf_str, std::string("0.10000000000000000555"));
+    usf::format_to(usf_str, 1200, "{:.25e}", 1.0 / 3.0);       CHECK_EQ(usf_str, std::string("3.3333333333333331482961626e-01"));
+    usf::format_to(usf_str, 1200, "{:.0f}", 1e23);             CHECK_EQ(usf_str, std::string("99999999999999991611392"));
+    usf::format_to(usf_str, 1200, "{:.30g}", 2.0 / 3.0);       CHECK_EQ(usf_str, std::string("0.666666666666666629659232512495"));
+    usf::format_to(usf_str, 1200, "{:.2f}", 2.675);            CHECK_EQ(usf_str, std::string("2.67"));
+    usf::format_to(usf_str, 1200, "{:.1f}", 0.25);             CHECK_EQ(usf_str, std::string("0.2"));
+    usf::format_to(usf_str, 1200, "{:.1f}", 0.35);             CHECK_EQ(usf_str, std::string("0.3"));
+
+    // Precision above the old 127 limit
+    sprintf(std_str, "%.760e", 5e-324);
+    usf::format_to(usf_str, 1200, "{:.760e}", 5e-324);
+    CHECK_EQ(usf_str, std::string(std_str));
+
+    sprintf(std_str, "%.1074f", 2.2250738585072014e-308);
+    usf::format_to(usf_str, 1200, "{:.1074f}", 2.2250738585072014e-308);
+    CHECK_EQ(usf_str, std::string(std_str));
+
+    // Digits around the small conversion buffer size (40 digits)
+    for(int precision = 36; precision <= 44; ++precision)
+    {
+        sprintf(std_str, "%.*e", precision, 1.0 / 3.0);
+        usf::format_to(usf_fmt, 16, "{{:.{:d}e}}", precision);
+        usf::format_to(usf_str, 1200, usf_fmt, 1.0 / 3.0);
+        CHECK_EQ(usf_str, std::string(std_str));
+
+        sprintf(std_str, "%.*f", precision, 123.456);
+        usf::format_to(usf_fmt, 16, "{{:.{:d}f}}", precision);
+        usf::format_to(usf_str, 1200, usf_fmt, 123.456);
+        CHECK_EQ(usf_str, std::string(std_str));
+    }
+
+    sprintf(std_str, "%f", 1.7976931348623157e308);
+    usf::format_to(usf_str, 1200, "{:f}", 1.7976931348623157e308);
+    CHECK_EQ(usf_str, std::string(std_str));
+
+    // Random bit patterns with random precision
+    std::mt19937_64 rng(5678);
+
+    for(int i = 0; i < 20000; ++i)
+    {
+        uint64_t bits = rng();
+        double value = 0;
+
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if(!std::isfinite(value)) { continue; }
+
+        const int precision = static_cast<int>(rng() % 800);
+
+        sprintf(std_str, "%.*e", precision, value);
+        usf::format_to(usf_fmt, 16, "{{:.{:d}e}}", precision);
+        usf::format_to(usf_str, 1200, usf_fmt, value);
+        CHECK_EQ(usf_str, std::string(std_str));
+
+        if(std::fabs(value) < 1e100 && std::fabs(value) > 1e-100)
+        {
+            sprintf(std_str, "%.*f", precision, value);
+            usf::format_to(usf_fmt, 16, "{{:.{:d}f}}", precision);
+            usf::format_to(usf_str, 1200, usf_fmt, value);
+            CHECK_EQ(usf_str, std::string(std_str));
+        }
+    }
+}
+
+TEST_CASE("usf::format_to, low precision fixed floating point conversion")
+{
+    char usf_str[64]{};
+    char std_str[64]{};
+    char usf_fmt[16]{};
+
+    // Correctly rounded (the decimal expansion decides, not the product)
+    usf::format_to(usf_str, 64, "{:.2f}", 1.005);              CHECK_EQ(usf_str, std::string("1.00"));
+    usf::format_to(usf_str, 64, "{:.1f}", 0.05);               CHECK_EQ(usf_str, std::string("0.1"));
+    usf::format_to(usf_str, 64, "{:.3f}", -0.0005);            CHECK_EQ(usf_str, std::string("-0.001"));
+    usf::format_to(usf_str, 64, "{:.0f}", 2.5);                CHECK_EQ(usf_str, std::string("2"));
+    usf::format_to(usf_str, 64, "{:.3f}", 999999999.9995);     CHECK_EQ(usf_str, std::string("1000000000.000"));
+    usf::format_to(usf_str, 64, "{:.1f}", -0.0);               CHECK_EQ(usf_str, std::string("-0.0"));
+    usf::format_to(usf_str, 64, "{:#.0f}", 7.0);               CHECK_EQ(usf_str, std::string("7."));
+    usf::format_to(usf_str, 64, "{:+08.2f}", -3.14159);        CHECK_EQ(usf_str, std::string("-0003.14"));
+    usf::format_to(usf_str, 64, "{:^9.1f}", 2.25F);            CHECK_EQ(usf_str, std::string("   2.2   "));
+    usf::format_to(usf_str, 64, "{:,.2f}", 1234567.891);       CHECK_EQ(usf_str, std::string("1,234,567.89"));
+
+    // Random values around the fast path limits
+    std::mt19937_64 rng(1357);
+
+    for(int i = 0; i < 100000; ++i)
+    {
+        const int precision = static_cast<int>(rng() % 10);
+        const double value = std::ldexp(static_cast<double>(rng() >> 11U), static_cast<int>(rng() % 64) - 64)
+                           * ((i % 2 != 0) ? -1.0 : 1.0);
+
+        sprintf(std_str, "%12.*f", precision, value);
+        usf::format_to(usf_fmt, 16, "{{:12.{:d}f}}", precision);
+        usf::format_to(usf_str, 64, usf_fmt, value);
+        CHECK_EQ(usf_str, std::string(std_str));
+    }
+}
+
+TEST_CASE("usf::format_to, single precision floating point conversion")
+{
+    char usf_str[64]{};
+
+    // Shortest representation of the float (not of the widened double)
+    usf::format_to(usf_str, 64, "{}", 0.1F);                   CHECK_EQ(usf_str, std::string("0.1"));
+    usf::format_to(usf_str, 64, "{}", 1.0F / 3.0F);            CHECK_EQ(usf_str, std::string("0.33333334"));
+    usf::format_to(usf_str, 64, "{}", 16777216.0F);            CHECK_EQ(usf_str, std::string("16777216"));
+    usf::format_to(usf_str, 64, "{}", 3.4028235e38F);          CHECK_EQ(usf_str, std::string("3.4028235e+38"));
+    usf::format_to(usf_str, 64, "{}", 1.17549435e-38F);        CHECK_EQ(usf_str, std::string("1.1754944e-38"));
+    usf::format_to(usf_str, 64, "{}", 1e-45F);                 CHECK_EQ(usf_str, std::string("1e-45"));
+    usf::format_to(usf_str, 64, "{}", -0.0F);                  CHECK_EQ(usf_str, std::string("-0"));
+    usf::format_to(usf_str, 64, "{:G}", 1e-5F);                CHECK_EQ(usf_str, std::string("1E-05"));
+    usf::format_to(usf_str, 64, "{:>10}", 2.5F);               CHECK_EQ(usf_str, std::string("       2.5"));
+
+    // Fixed precision formats (same digits as the double)
+    usf::format_to(usf_str, 64, "{:.3f}", 0.1F);               CHECK_EQ(usf_str, std::string("0.100"));
+    usf::format_to(usf_str, 64, "{:.10f}", 0.1F);              CHECK_EQ(usf_str, std::string("0.1000000015"));
+    usf::format_to(usf_str, 64, "{:e}", 123.456F);             CHECK_EQ(usf_str, std::string("1.234560e+02"));
+    usf::format_to(usf_str, 64, "{:#g}", 2.5F);                CHECK_EQ(usf_str, std::string("2.50000"));
+
+    // Round trip on random bit patterns
+    std::mt19937 rng(1234);
+
+    for(int i = 0; i < 100000; ++i)
+    {
+        const auto bits = static_cast<uint32_t>(rng());
+        float value = 0;
+
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if(!std::isfinite(value)) { continue; }
+
+        usf::format_to(usf_str, 64, "{}", value);
+
+        const float parsed = std::strtof(usf_str, nullptr);
+
+        CHECK_EQ(std::memcmp(&parsed, &value, sizeof(value)), 0);
+    }
+}
+
+TEST_CASE("usf::format_to, hexadecimal floating point conversion")
+{
+    char usf_str[64]{};
+    char std_str[64]{};
+    char usf_fmt[16]{};
+
+    usf::format_to(usf_str, 64, "{:a}", 1.0);                  CHECK_EQ(usf_str, std::string("0x1p+0"));
+    usf::format_to(usf_str, 64, "{:a}", 0.1);                  CHECK_EQ(usf_str, std::string("0x1.999999999999ap-4"));
+    usf::format_to(usf_str, 64, "{:A}", -255.5);               CHECK_EQ(usf_str, std::string("-0X1.FFP+7"));
+    usf::format_to(usf_str, 64, "{:a}", 0.1F);                 CHECK_EQ(usf_str, std::string("0x1.99999ap-4"));
+    usf::format_to(usf_str, 64, "{:a}", 5e-324);               CHECK_EQ(usf_str, std::string("0x0.0000000000001p-1022"));
+    usf::format_to(usf_str, 64, "{:a}", 1.7976931348623157e308); CHECK_EQ(usf_str, std::string("0x1.fffffffffffffp+1023"));
+    usf::format_to(usf_str, 64, "{:a}", 0.0);                  CHECK_EQ(usf_str, std::string("0x0p+0"));
+    usf::format_to(usf_str, 64, "{:.3a}", -0.0);               CHECK_EQ(usf_str, std::string("-0x0.000p+0"));
+    usf::format_to(usf_str, 64, "{:#a}", 2.0);                 CHECK_EQ(usf_str, std::string("0x1.p+1"));
+    usf::format_to(usf_str, 64, "{:.0a}", 1.5);                CHECK_EQ(usf_str, std::string("0x2p+0"));
+    usf::format_to(usf_str, 64, "{:.1a}", 1.03125);            CHECK_EQ(usf_str, std::string("0x1.0p+0"));
+    usf::format_to(usf_str, 64, "{:.1a}", 1.09375);            CHECK_EQ(usf_str, std::string("0x1.2p+0"));
+    usf::format_to(usf_str, 64, "{:.15a}", 1.0);               CHECK_EQ(usf_str, std::string("0x1.000000000000000p+0"));
+    usf::format_to(usf_str, 64, "{:+012a}", 1.5);              CHECK_EQ(usf_str, std::string("+0x0001.8p+0"));
+    usf::format_to(usf_str, 64, "{:^12a}", 1.5);               CHECK_EQ(usf_str, std::string("  0x1.8p+0  "));
+    usf::format_to(usf_str, 64, "{:a}", -INFINITY);            CHECK_EQ(usf_str, std::string("-inf"));
+
+    CHECK_THROWS_AS(usf::format_to(usf_str, 64, "{:,a}", 1.0), std::runtime_error);
+    CHECK_THROWS_AS(usf::format_to(usf_str, 64, "{:a}", 1), std::runtime_error);
+
+    // Random bit patterns with random precision
+    std::mt19937_64 rng(8765);
+
+    for(int i = 0; i < 100000; ++i)
+    {
+        uint64_t bits = rng();
+
+        // Subnormals
+        if(i % 4 == 0) { bits = (bits & UINT64_C(0x800FFFFFFFFFFFFF)) >> (rng() % 53); }
+
+        double value = 0;
+
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if(!std::isfinite(value)) { continue; }
+
+        const int precision = static_cast<int>(rng() % 16);
+
+        sprintf(std_str, "%.*a", precision, value);
+        usf::format_to(usf_fmt, 16, "{{:.{:d}a}}", precision);
+        usf::format_to(usf_str, 64, usf_fmt, value);
+        CHECK_EQ(usf_str, std::string(std_str));
+
+        sprintf(std_str, "%A", value);
+        usf::format_to(usf_str, 64, "{:A}", value);
+        CHECK_EQ(usf_str, std::string(std_str));
+    }
+}
+
+// Exact value of the binary16 or bfloat16 bits
+static double float16_value(const uint16_t bits, const bool bfloat)
+{
+    if(bfloat)
+    {
+        const uint32_t float_bits = static_cast<uint32_t>(bits) << 16U;
+        float value = 0;
+        std::memcpy(&value, &float_bits, sizeof(value));
+        return static_cast<double>(value);
+    }
+
+    const int exponent = (bits >> 10U) & 0x1F;
+    const int mantissa = bits & 0x3FF;
+
+    const double value = (exponent == 0) ? std::ldexp(mantissa, -24) : std::ldexp(mantissa | 0x400, exponent - 25);
+
+    return (bits & 0x8000U) ? -value : value;
+}
+
+static void test_float16_shortest(const uint16_t bits, const bool bfloat)
+{
+    char usf_str[64]{};
+    char std_str[64]{};
+
+    if(bfloat) { usf::format_to(usf_str, 64, "{}", usf::BFloat16(bits)); }
+    else       { usf::format_to(usf_str, 64, "{}", usf::Float16 (bits)); }
+
+    // Parses back to the same value (inside the rounding interval, bounds included if even)
+    const double value = float16_value(bits, bfloat);
+    const double lower = (value + float16_value(static_cast<uint16_t>(bits - 1), bfloat)) / 2;
+    const double next  = float16_value(static_cast<uint16_t>(bits + 1), bfloat);
+    const double upper = std::isinf(next) ? value + (value - lower) : (value + next) / 2;
+    const double parsed = std::strtod(usf_str, nullptr);
+
+    const bool inside = (bits & 1U) ? (parsed > lower && parsed < upper) : (parsed >= lower && parsed <= upper);
+
+    CHECK_MESSAGE(inside, usf_str);
+
+    // Not longer than the shortest correctly rounded representation
+    int digits = 1;
+
+    for(; digits < 9; ++digits)
+    {
+        sprintf(std_str, "%.*e", digits - 1, value);
+
+        const double candidate = std::strtod(std_str, nullptr);
+
+        if((bits & 1U) ? (candidate > lower && candidate < upper) : (candidate >= lower && candidate <= upper)) { break; }
+    }
+
+    int usf_digits = 0;
+
+    for(const char* it = usf_str; *it != '\0' && *it != 'e'; ++it)
+    {
+        if(*it >= '1' && *it <= '9') { usf_digits = 1; break; }
+    }
+
+    for(const char* it = usf_str; *it != '\0' && *it != 'e'; ++it)
+    {
+        if(*it >= '0' && *it <= '9' && usf_digits > 0) { ++usf_digits; }
+    }
+
+    CHECK_MESSAGE(usf_digits > 0, usf_str);
+}
+
+TEST_CASE("usf::format_to, 16 bit floating point conversion")
+{
+    char usf_str[64]{};
+
+    usf::format_to(usf_str, 64, "{}", usf::Float16(0x3C00));   CHECK_EQ(usf_str, std::string("1"));
+    usf::format_to(usf_str, 64, "{}", usf::Float16(0x3555));   CHECK_EQ(usf_str, std::string("0.3333"));
+    usf::format_to(usf_str, 64, "{}", usf::Float16(0x2E66));   CHECK_EQ(usf_str, std::string("0.1"));
+    usf::format_to(usf_str, 64, "{}", usf::Float16(0x7BFF));   CHECK_EQ(usf_str, std::string("65500"));
+    usf::format_to(usf_str, 64, "{}", usf::Float16(0x0001));   CHECK_EQ(usf_str, std::string("6e-08"));
+    usf::format_to(usf_str, 64, "{}", usf::Float16(0x8000));   CHECK_EQ(usf_str, std::string("-0"));
+    usf::format_to(usf_str, 64, "{}", usf::Float16(0xFC00));   CHECK_EQ(usf_str, std::string("-inf"));
+    usf::format_to(usf_str, 64, "{}", usf::Float16(0x7E00));   CHECK_EQ(usf_str, std::string("nan"));
+    usf::format_to(usf_str, 64, "{:.5f}", usf::Float16(0x2E66)); CHECK_EQ(usf_str, std::string("0.09998"));
+    usf::format_to(usf_str, 64, "{:a}", usf::Float16(0x3C00)); CHECK_EQ(usf_str, std::string("0x1p+0"));
+    usf::format_to(usf_str, 64, "{:>8}", usf::Float16(0xC100)); CHECK_EQ(usf_str, std::string("    -2.5"));
+
+    usf::format_to(usf_str, 64, "{}", usf::BFloat16(0x3F80));  CHECK_EQ(usf_str, std::string("1"));
+    usf::format_to(usf_str, 64, "{}", usf::BFloat16(0x3DCD));  CHECK_EQ(usf_str, std::string("0.1"));
+    usf::format_to(usf_str, 64, "{}", usf::BFloat16(0x7F7F));  CHECK_EQ(usf_str, std::string("3.39e+38"));
+    usf::format_to(usf_str, 64, "{}", usf::BFloat16(0xFF80));  CHECK_EQ(usf_str, std::string("-inf"));
+    usf::format_to(usf_str, 64, "{:e}", usf::BFloat16(0x4049)); CHECK_EQ(usf_str, std::string("3.140625e+00"));
+
+    // All the finite values
+    for(uint32_t bits = 1; bits < 0x7C00; ++bits)
+    {
+        test_float16_shortest(static_cast<uint16_t>(bits), false);
+    }
+
+    for(uint32_t bits = 1; bits < 0x7F80; ++bits)
+    {
+        test_float16_shortest(static_cast<uint16_t>(bits), true);
+    }
+}
+
+#if defined(USF_LONG_DOUBLE_X87) || defined(USF_LONG_DOUBLE_BINARY128)
+TEST_CASE("usf::format_to, long double floating point conversion")
+{
+    static char usf_str[1200]{};
+    static char std_str[1200]{};
+    char usf_fmt[16]{};
+
+    usf::format_to(usf_str, 1200, "{}", 0.1L);                 CHECK_EQ(usf_str, std::string("0.1"));
+    usf::format_to(usf_str, 1200, "{}", -2.5L);                CHECK_EQ(usf_str, std::string("-2.5"));
+    usf::format_to(usf_str, 1200, "{}", 1e4000L);              CHECK_EQ(usf_str, std::string("1e+4000"));
+    usf::format_to(usf_str, 1200, "{:e}", 1e-4000L);           CHECK_EQ(usf_str, std::string("1.000000e-4000"));
+    usf::format_to(usf_str, 1200, "{:>8}", 0.0L);              CHECK_EQ(usf_str, std::string("       0"));
+    usf::format_to(usf_str, 1200, "{:.3f}", 2.675L);           CHECK_EQ(usf_str, std::string("2.675"));
+    usf::format_to(usf_str, 1200, "{}", -HUGE_VALL);           CHECK_EQ(usf_str, std::string("-inf"));
+
+    CHECK_THROWS_AS(usf::format_to(usf_str, 1200, "{:a}", 1.0L), std::runtime_error);
+
+    // Random bit patterns with random precision and shortest round trip
+    std::mt19937_64 rng(4321);
+
+    for(int i = 0; i < 5000; ++i)
+    {
+        long double value = static_cast<long double>(std::ldexp(static_cast<double>(rng() >> 11U), -53));
+
+        value *= std::pow(10.0L, static_cast<int>(rng() % 9000) - 4500);
+
+        if(i % 2 != 0) { value = -value; }
+
+        const int precision = static_cast<int>(rng() % 40);
+
+        sprintf(std_str, "%.*Le", precision, value);
+        usf::format_to(usf_fmt, 16, "{{:.{:d}e}}", precision);
+        usf::format_to(usf_str, 1200, usf_fmt, value);
+        CHECK_EQ(usf_str, std::string(std_str));
+
+        if(std::fabs(value) < 1e100L)
+        {
+            sprintf(std_str, "%.*Lf", precision, value);
+            usf::format_to(usf_fmt, 16, "{{:.{:d}f}}", precision);
+            usf::format_to(usf_str, 1200, usf_fmt, value);
+            CHECK_EQ(usf_str, std::string(std_str));
+        }
+
+        usf::format_to(usf_str, 1200, "{}", value);
+
+        const long double parsed = std::strtold(usf_str, nullptr);
+
+        CHECK_EQ(std::memcmp(&parsed, &value, LDBL_MANT_DIG == 64 ? 10 : sizeof(value)), 0);
+    }
+}
+#endif
+
+#if defined(USF_FLOAT128_SUPPORT)
+TEST_CASE("usf::format_to, __float128 floating point conversion")
+{
+    static char usf_str[1200]{};
+
+    const usf::float128_t one   = 1;
+    const usf::float128_t third = one / 3;
+    const usf::float128_t tenth = one / 10;
+
+    usf::format_to(usf_str, 1200, "{}", tenth);                CHECK_EQ(usf_str, std::string("0.1"));
+    usf::format_to(usf_str, 1200, "{}", -third);               CHECK_EQ(usf_str, std::string("-0.3333333333333333333333333333333333"));
+    usf::format_to(usf_str, 1200, "{:.40f}", tenth);           CHECK_EQ(usf_str, std::string("0.1000000000000000000000000000000000048148"));
+    usf::format_to(usf_str, 1200, "{:e}", tenth * 1e30);       CHECK_EQ(usf_str, std::string("1.000000e+29"));
+    usf::format_to(usf_str, 1200, "{:+,.2f}", one * 1234567);  CHECK_EQ(usf_str, std::string("+1,234,567.00"));
+    usf::format_to(usf_str, 1200, "{}", -one * HUGE_VAL);      CHECK_EQ(usf_str, std::string("-inf"));
+
+    CHECK_THROWS_AS(usf::format_to(usf_str, 1200, "{:a}", one), std::runtime_error);
+
+#if defined(USF_LONG_DOUBLE_X87)
+    // Same fixed precision digits as the (exactly converted) long double
+    static char std_str[1200]{};
+    char usf_fmt[16]{};
+
+    std::mt19937_64 rng(2468);
+
+    for(int i = 0; i < 2000; ++i)
+    {
+        long double value = static_cast<long double>(std::ldexp(static_cast<double>(rng() >> 11U), -53));
+
+        value *= std::pow(10.0L, static_cast<int>(rng() % 200) - 100);
+
+        const int precision = static_cast<int>(rng() % 40);
+
+        sprintf(std_str, "%.*Le", precision, value);
+        usf::format_to(usf_fmt, 16, "{{:.{:d}e}}", precision);
+        usf::format_to(usf_str, 1200, usf_fmt, static_cast<usf::float128_t>(value));
+        CHECK_EQ(usf_str, std::string(std_str));
+    }
+#endif
+}
+#endif
+
+TEST_CASE("usf::format_floats_to, floating point array conversion")
+{
+    char usf_str[512]{};
+
+    const usf::StringSpan usf_span(usf_str, 512);
+
+    const double values[]{0.125, 0.375, 2.675, -0.0, -1.5, 2.5, 1e20, NAN, -INFINITY};
+
+    usf::format_floats_to(usf_span, values, 9, 2, ",");
+    CHECK_EQ(usf_str, std::string("0.12,0.38,2.67,-0.00,-1.50,2.50,100000000000000000000.00,nan,-inf"));
+
+    usf::format_floats_to(usf_span, values, 3, 0, ", ");
+    CHECK_EQ(usf_str, std::string("0, 0, 3"));
+
+    usf::format_floats_to(usf_span, values, 2, 8, "; ");
+    CHECK_EQ(usf_str, std::string("0.12500000; 0.37500000"));
+
+    const float floats[]{0.1F, -2.5F, 1234.5678F};
+
+    usf::format_floats_to(usf_span, floats, 3, 3, " ");
+    CHECK_EQ(usf_str, std::string("0.100 -2.500 1234.568"));
+
+    const auto result = usf::format_floats_to(usf_span, values, 0, 3, ",");
+    CHECK_EQ(result.size(), 0);
+
+    CHECK_THROWS_AS(usf::format_floats_to(usf::StringSpan(usf_str, 8), values, 3, 2, ","), std::runtime_error);
+    CHECK_THROWS_AS(usf::format_floats_to(usf_span, values, 3, -1, ","), std::runtime_error);
+
+    // Random values (many of them halfway or close to it) against sprintf
+    std::mt19937_64 rng(2468);
+
+    for(int i = 0; i < 2000; ++i)
+    {
+        double array[16]{};
+        std::string std_str;
+
+        const int count = static_cast<int>(rng() % 17);
+        const int precision = static_cast<int>(rng() % 9);
+
+        for(int n = 0; n < count; ++n)
+        {
+            const auto integer = static_cast<double>(static_cast<int64_t>(rng() % 2000000) - 1000000);
+
+            switch(rng() % 3)
+            {
+                case 0:  array[n] = integer / 1000.0;                                           break;
+                case 1:  array[n] = integer / static_cast<double>(UINT64_C(1) << (rng() % 16)); break;
+                default: array[n] = std::ldexp(integer, static_cast<int>(rng() % 80) - 40);     break;
+            }
+
+            char std_value[512]{};
+            sprintf(std_value, "%.*f", precision, array[n]);
+
+            if(n > 0) { std_str += ','; }
+            std_str += std_value;
+        }
+
+        usf::format_floats_to(usf_span, array, count, precision, ",");
+        CHECK_EQ(usf_str, std_str);
+    }
+}
+
 #endif // defined(USF_TEST_FLOATING_POINT)
@@ -40,13 +40,14 @@ TEST_CASE("usf::format_to, format spec")
         usf::format_to(str, 128, "{:.1e}", 1.234); CHECK_EQ(str, "1.2e+00");
         usf::format_to(str, 128, "{:.1g}", 1.234); CHECK_EQ(str, "1");
         usf::format_to(str, 128, "{:.1s}", "str"); CHECK_EQ(str, "s");
+        usf::format_to(str, 128, "{:.1d}", 123  ); CHECK_EQ(str, "123");
+        usf::format_to(str, 128, "{:.1x}", 123  ); CHECK_EQ(str, "7b");
+        usf::format_to(str, 128, "{:.1o}", 123  ); CHECK_EQ(str, "173");
+        usf::format_to(str, 128, "{:.1b}", 123  ); CHECK_EQ(str, "1111011");
 
         // PRECISION + INVALID TYPE
         CHECK_THROWS_AS(usf::format_to(str, 128, "{:.1c}", 'N'), std::runtime_error);
-        CHECK_THROWS_AS(usf::format_to(str, 128, "{:.1d}", 123), std::runtime_error);
-        CHECK_THROWS_AS(usf::format_to(str, 128, "{:.1x}", 123), std::runtime_error);
-        CHECK_THROWS_AS(usf::format_to(str, 128, "{:.1o}", 123), std::runtime_error);
-        CHECK_THROWS_AS(usf::format_to(str, 128, "{:.1b}", 123), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:.1p}", ptr), std::runtime_error);
 
         // PRECISION WITHOUT TYPE
         CHECK_THROWS_AS(usf::format_to(str, 128, "{:.1}", false), std::runtime_error);
@@ -298,6 +299,233 @@ TEST_CASE("usf::format_to, format spec")
         usf::format_to(str, 128, "{:*> #014.2g}", -1.0); CHECK_EQ(str, "-00000000001.0");
         usf::format_to(str, 128, "{:*> #014.0g}", -1.0); CHECK_EQ(str, "-000000000001.");
     }
+    {
+        // DIGIT GROUPING (integers)
+        usf::format_to(str, 128, "{:,}", 0          ); CHECK_EQ(str, "0");
+        usf::format_to(str, 128, "{:,}", 999        ); CHECK_EQ(str, "999");
+        usf::format_to(str, 128, "{:,}", 1000       ); CHECK_EQ(str, "1,000");
+        usf::format_to(str, 128, "{:,}", -1234567   ); CHECK_EQ(str, "-1,234,567");
+        usf::format_to(str, 128, "{:_d}", 1234567   ); CHECK_EQ(str, "1_234_567");
+        usf::format_to(str, 128, "{:,}", UINT64_MAX ); CHECK_EQ(str, "18,446,744,073,709,551,615");
+        usf::format_to(str, 128, "{:_x}", 0xFFFF    ); CHECK_EQ(str, "ffff");
+        usf::format_to(str, 128, "{:_x}", 0x10000   ); CHECK_EQ(str, "1_0000");
+        usf::format_to(str, 128, "{:#_X}", UINT64_MAX); CHECK_EQ(str, "0XFFFF_FFFF_FFFF_FFFF");
+        usf::format_to(str, 128, "{:_o}", 01234567  ); CHECK_EQ(str, "123_4567");
+        usf::format_to(str, 128, "{:#_b}", 0x5A     ); CHECK_EQ(str, "0b101_1010");
+
+        // DIGIT GROUPING + WIDTH (the zero fill is not grouped)
+        usf::format_to(str, 128, "{:>12,}", 1234567 ); CHECK_EQ(str, "   1,234,567");
+        usf::format_to(str, 128, "{:<12,}", 1234567 ); CHECK_EQ(str, "1,234,567   ");
+        usf::format_to(str, 128, "{:+012,d}", 1234567); CHECK_EQ(str, "+001,234,567");
+
+        // DIGIT GROUPING (floating point integer part)
+        usf::format_to(str, 128, "{:,.2f}", 1234567.891); CHECK_EQ(str, "1,234,567.89");
+        usf::format_to(str, 128, "{:_.3f}", -1000.5    ); CHECK_EQ(str, "-1_000.500");
+        usf::format_to(str, 128, "{:,.1f}", 999.25     ); CHECK_EQ(str, "999.2");
+        usf::format_to(str, 128, "{:,.0f}", 1E15       ); CHECK_EQ(str, "1,000,000,000,000,000");
+        usf::format_to(str, 128, "{:#,.0f}", 1E6       ); CHECK_EQ(str, "1,000,000.");
+        usf::format_to(str, 128, "{:,g}", 123456.0     ); CHECK_EQ(str, "123,456");
+        usf::format_to(str, 128, "{:,e}", 123456.0     ); CHECK_EQ(str, "1.234560e+05");
+
+        // DIGIT GROUPING + INVALID TYPE
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:,}", false), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:,}", 'N'  ), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:,}", "str"), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:,c}", 'N' ), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:,s}", "str"), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:,p}", ptr ), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:,x}", 123 ), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:,o}", 123 ), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:,b}", 123 ), std::runtime_error);
+    }
+    {
+        // ARBITRARY RADIX
+        usf::format_to(str, 128, "{:r2}", 5             ); CHECK_EQ(str, "101");
+        usf::format_to(str, 128, "{:r10}", -123         ); CHECK_EQ(str, "-123");
+        usf::format_to(str, 128, "{:r16}", 255          ); CHECK_EQ(str, "ff");
+        usf::format_to(str, 128, "{:r36}", 35           ); CHECK_EQ(str, "z");
+        usf::format_to(str, 128, "{:R36}", 35           ); CHECK_EQ(str, "Z");
+        usf::format_to(str, 128, "{:r62}", 61           ); CHECK_EQ(str, "Z");
+        usf::format_to(str, 128, "{:R62}", 61           ); CHECK_EQ(str, "z");
+        usf::format_to(str, 128, "{:r36}", UINT64_MAX   ); CHECK_EQ(str, "3w5e11264sgsf");
+        usf::format_to(str, 128, "{:r62}", UINT64_MAX   ); CHECK_EQ(str, "lYGhA16ahyf");
+        usf::format_to(str, 128, "{:*>8r36}", 1295      ); CHECK_EQ(str, "******zz");
+        usf::format_to(str, 128, "{:+08r36}", 1295      ); CHECK_EQ(str, "+00000zz");
+
+        // ARBITRARY RADIX + INVALID BASE / FLAGS
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:r}", 123   ), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:r0}", 123  ), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:r1}", 123  ), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:r63}", 123 ), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:#r36}", 123), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:_r36}", 123), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:r36}", 1.0 ), std::runtime_error);
+    }
+    {
+        // INTEGER PRECISION (minimum number of digits)
+        usf::format_to(str, 128, "{:.8d}", 123          ); CHECK_EQ(str, "00000123");
+        usf::format_to(str, 128, "{:.8d}", -123         ); CHECK_EQ(str, "-00000123");
+        usf::format_to(str, 128, "{:+.4d}", 5           ); CHECK_EQ(str, "+0005");
+        usf::format_to(str, 128, "{:.16x}", 0xBEEF      ); CHECK_EQ(str, "000000000000beef");
+        usf::format_to(str, 128, "{:#.6X}", 0xBEEF      ); CHECK_EQ(str, "0X00BEEF");
+        usf::format_to(str, 128, "{:.4o}", 8            ); CHECK_EQ(str, "0010");
+        usf::format_to(str, 128, "{:.12b}", 5           ); CHECK_EQ(str, "000000000101");
+        usf::format_to(str, 128, "{:.4r36}", 1295       ); CHECK_EQ(str, "00zz");
+        usf::format_to(str, 128, "{:.3d}", 123456       ); CHECK_EQ(str, "123456");
+        usf::format_to(str, 128, "{:.0d}", 0            ); CHECK_EQ(str, "");
+        usf::format_to(str, 128, "{:.0x}", 0U           ); CHECK_EQ(str, "");
+        usf::format_to(str, 128, "{:+3.0d}", 0          ); CHECK_EQ(str, "  +");
+        usf::format_to(str, 128, "{:.0d}", 7            ); CHECK_EQ(str, "7");
+        usf::format_to(str, 128, "{:.1d}", 0            ); CHECK_EQ(str, "0");
+        usf::format_to(str, 128, "{:10.6d}", 42         ); CHECK_EQ(str, "    000042");
+        usf::format_to(str, 128, "{:<10.6d}", -42       ); CHECK_EQ(str, "-000042   ");
+        usf::format_to(str, 128, "{:010.6d}", -42       ); CHECK_EQ(str, "   -000042");
+        usf::format_to(str, 128, "{:08.3d}", 5          ); CHECK_EQ(str, "     005");
+        usf::format_to(str, 128, "{:#08.3x}", 5         ); CHECK_EQ(str, "   0x005");
+        usf::format_to(str, 128, "{:0=8.3d}", 5         ); CHECK_EQ(str, "00000005");
+        usf::format_to(str, 128, "{:.3d}", true         ); CHECK_EQ(str, "001");
+        usf::format_to(str, 128, "{:.3d}", 'A'          ); CHECK_EQ(str, "065");
+        usf::format_to(str, 128, "{:.24d}", UINT64_MAX  ); CHECK_EQ(str, "000018446744073709551615");
+        usf::format_to(str, 128, "{:.20X}", UINT64_MAX  ); CHECK_EQ(str, "0000FFFFFFFFFFFFFFFF");
+        usf::format_to(str, 128, "{:.24o}", UINT64_MAX  ); CHECK_EQ(str, "001777777777777777777777");
+        usf::format_to(str, 128, "{:.66b}", UINT64_MAX  ); CHECK_EQ(str, "00" "1111111111111111111111111111111111111111111111111111111111111111");
+
+        // ZERO PADDED FIXED WIDTH (fused with the conversion)
+        usf::format_to(str, 128, "{:08x}", 0xBEEF       ); CHECK_EQ(str, "0000beef");
+        usf::format_to(str, 128, "{:016X}", UINT32_MAX  ); CHECK_EQ(str, "00000000FFFFFFFF");
+        usf::format_to(str, 128, "{:#010x}", 0xBEEF     ); CHECK_EQ(str, "0x0000beef");
+        usf::format_to(str, 128, "{:010d}", 1234567     ); CHECK_EQ(str, "0001234567");
+        usf::format_to(str, 128, "{:010d}", -1234567    ); CHECK_EQ(str, "-001234567");
+        usf::format_to(str, 128, "{:+06d}", 42          ); CHECK_EQ(str, "+00042");
+        usf::format_to(str, 128, "{:06d}", 1234567      ); CHECK_EQ(str, "1234567");
+        usf::format_to(str, 128, "{:#012o}", 8          ); CHECK_EQ(str, "000000000010");
+        usf::format_to(str, 128, "{:#010b}", 5          ); CHECK_EQ(str, "0b00000101");
+        usf::format_to(str, 128, "{:0=8d}", -5          ); CHECK_EQ(str, "-0000005");
+
+        // INTEGER PRECISION + INVALID FLAGS
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:,.8d}", 123 ), std::runtime_error);
+        CHECK_THROWS_AS(usf::format_to(str, 128, "{:_.8x}", 123 ), std::runtime_error);
+    }
+}
+
+TEST_CASE("usf::format_to, long literal text")
+{
+    char str[128]{};
+
+    // Braces at any position of the blocks scanned at once
+    for(std::size_t pos = 0; pos < 40; ++pos)
+    {
+        std::string fmt(48, 'a');
+        std::string ref(48, 'a');
+
+        fmt.replace(pos, 1, "{}}}");
+        ref.replace(pos, 1, "7}");
+
+        usf::format_to(str, 128, usf::StringView(fmt.data(), static_cast<std::ptrdiff_t>(fmt.size())), 7);
+        CHECK_EQ(str, ref);
+    }
+
+    usf::format_to(str, 128, "127.0.0.1 - - [{{10/Oct/2000:13:55:36 -0700}}] \"GET /apache_pb.gif HTTP/1.0\" {} {}", 200, 2326);
+    CHECK_EQ(str, "127.0.0.1 - - [{10/Oct/2000:13:55:36 -0700}] \"GET /apache_pb.gif HTTP/1.0\" 200 2326");
+
+    wchar_t wstr[128]{};
+    usf::basic_format_to(wstr, 128, usf::WStringView(L"long literal text before {{the}} argument: {}!"), 42);
+    CHECK_EQ(std::wstring(wstr), L"long literal text before {the} argument: 42!");
+
+    // Destination too small and unmatched brace
+    CHECK_THROWS_AS(usf::format_to(str, 21, "0123456789abcdefghijklmnopqrstuvwxyz"), std::runtime_error);
+    CHECK_THROWS_AS(usf::format_to(str, 128, "literal text longer than a block } {}", 1), std::runtime_error);
+}
+
+TEST_CASE("usf::format_to, runtime compiled format")
+{
+    char str[128]{};
+    char ref[128]{};
+
+    // Same output as the format string parsed on each call
+    const char* const formats[]{"", "literal text only", "}}{{}}{{", "{{{}}}", "x={} y={:.3f} z={:>8} {{lit}} {0:#06x}",
+                                "{2}{1}{0}{}", "a{}b{}c{}d", "{:<10}|{:^9}|{:>8}"};
+
+    for(const char* const fmt : formats)
+    {
+        const usf::CompiledFormat<char, 4> compiled{usf::StringView(fmt)};
+
+        usf::format_to(str, 128, compiled, 42, 3.14159, "abc");
+        usf::format_to(ref, 128, fmt, 42, 3.14159, "abc");
+        CHECK_EQ(str, ref);
+    }
+
+    using CompiledFormat2 = usf::CompiledFormat<char, 2>;
+
+    const CompiledFormat2 compiled{usf::StringView("[{}] [{}]")};
+
+    CHECK_EQ(compiled.spec_count(), 2);
+    CHECK_EQ(compiled.arg_count(), 2);
+
+    const usf::StringSpan result = usf::format_to(usf::StringSpan(str, 128), compiled, 1, -2);
+    CHECK_EQ(str, "[1] [-2]");
+    CHECK_EQ(result.size(), 8);
+
+    // Invalid format strings are rejected when compiled
+    CHECK_THROWS_AS(CompiledFormat2{usf::StringView("{}{}{}")}, std::runtime_error);
+    CHECK_THROWS_AS(CompiledFormat2{usf::StringView("a}b")}, std::runtime_error);
+    CHECK_THROWS_AS(CompiledFormat2{usf::StringView("{:q}")}, std::runtime_error);
+
+    // Missing arguments and destination too small
+    CHECK_THROWS_AS(usf::format_to(str, 128, compiled, 1), std::runtime_error);
+    CHECK_THROWS_AS(usf::format_to(str, 5, compiled, 1, 2), std::runtime_error);
+}
+
+#if USF_CPP14_OR_GREATER
+TEST_CASE("usf::format_to, compile-time format string")
+{
+    char str[128]{};
+    char ref[128]{};
+
+    // Same output as the runtime parsed format string
+    usf::format_to(str, 128, USF_FMT("x={} y={:.3f} z={:>8} {{lit}} {0:#06x}"), 42, 3.14159, "abc");
+    usf::format_to(ref, 128,         "x={} y={:.3f} z={:>8} {{lit}} {0:#06x}" , 42, 3.14159, "abc");
+    CHECK_EQ(str, ref);
+
+    usf::format_to(str, 128, USF_FMT(""));                     CHECK_EQ(str, "");
+    usf::format_to(str, 128, USF_FMT("literal text only"));    CHECK_EQ(str, "literal text only");
+    usf::format_to(str, 128, USF_FMT("}}{{}}{{"));             CHECK_EQ(str, "}{}{");
+    usf::format_to(str, 128, USF_FMT("{2}{1}{0}"), 'a', true, -7); CHECK_EQ(str, "-7truea");
+    usf::format_to(str, 128, USF_FMT("{:<6}|{:^7}|{:_b}"), -1, "ab", 255U); CHECK_EQ(str, "-1    |  ab   |1111_1111");
+
+    const usf::StringSpan result = usf::format_to(usf::StringSpan(str, 128), USF_FMT("[{}]"), 12345);
+    CHECK_EQ(result.size(), 7);
+
+    char16_t str16[16]{};
+    usf::format_to(str16, 16, USF_FMT(u"{}-{}"), 1, 2);
+    CHECK_UNARY(str16[0] == u'1' && str16[1] == u'-' && str16[2] == u'2' && str16[3] == 0);
+
+    // Destination too small
+    CHECK_THROWS_AS(usf::format_to(str, 8, USF_FMT("0123456789{}"), 1), std::runtime_error);
+    CHECK_THROWS_AS(usf::format_to(str, 12, USF_FMT("0123456789{}"), 12345), std::runtime_error);
+}
+#endif // USF_CPP14_OR_GREATER
+
+TEST_CASE("usf::format_to, constexpr formatting")
+{
+    // The SIMD, SWAR word store and table lookup paths have constexpr fallbacks
+    TEST_STATIC_ASSERT(test_format_equal("{}", uint64_t{1234567890123U}, "1234567890123"));
+    TEST_STATIC_ASSERT(test_format_equal("{}", int64_t{-1234567890123}, "-1234567890123"));
+    TEST_STATIC_ASSERT(test_format_equal("{}", uint64_t{18446744073709551615U}, "18446744073709551615"));
+    TEST_STATIC_ASSERT(test_format_equal("{:x}", uint64_t{0xdeadbeefcafeU}, "deadbeefcafe"));
+    TEST_STATIC_ASSERT(test_format_equal("{:X}", 0xdeadbeefU, "DEADBEEF"));
+    TEST_STATIC_ASSERT(test_format_equal("{:08b}", 5, "00000101"));
+    TEST_STATIC_ASSERT(test_format_equal("{:o}", 01234567012, "1234567012"));
+    TEST_STATIC_ASSERT(test_format_equal("{}", uint16_t{123}, "123"));
+    TEST_STATIC_ASSERT(test_format_equal("{:>4}", uint8_t{7}, "   7"));
+    TEST_STATIC_ASSERT(test_format_equal("{:.5d}", 42, "00042"));
+    TEST_STATIC_ASSERT(test_format_equal("long literal text before the argument: {}", 1, "long literal text before the argument: 1"));
+
+    // Same results at runtime
+    CHECK_UNARY(test_format_equal("{}", uint64_t{1234567890123U}, "1234567890123"));
+    CHECK_UNARY(test_format_equal("{:x}", uint64_t{0xdeadbeefcafeU}, "deadbeefcafe"));
+    CHECK_UNARY(test_format_equal("{:08b}", 5, "00000101"));
+    CHECK_UNARY(test_format_equal("{}", uint16_t{123}, "123"));
 }
 
 #endif // #if defined(USF_TEST_FORMAT_SPEC)
@@ -0,0 +1,72 @@
+
+// Built with the format string parse cache. The other translation units are
+// built without it, so this also checks that both live in the same program.
+#define USF_ENABLE_PARSE_CACHE
+
+#include "unit_tests_config.hpp"
+
+// ----------------------------------------------------------------------------
+// FORMAT STRING PARSE CACHE
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::format_to, format string parse cache")
+{
+    char str[128]{};
+
+    usf::parse_cache_clear();
+
+    // First call parses (miss), the next ones reuse the cached specs (hits)
+    for(int i = 0; i < 3; ++i)
+    {
+        usf::format_to(str, 128, "x={} y={:>5} {{z}} {:#x}", i, "ab", 255);
+        CHECK_EQ(str, std::string("x=") + std::to_string(i) + " y=   ab {z} 0xff");
+    }
+
+    CHECK_EQ(usf::parse_cache_stats().hits, 2);
+    CHECK_EQ(usf::parse_cache_stats().misses, 1);
+
+    // Too many argument specs to be cached: parsed on each call
+    usf::format_to(str, 128, "{}{}{}{}{}{}{}{}{}", 1, 2, 3, 4, 5, 6, 7, 8, 9);
+    CHECK_EQ(str, "123456789");
+    usf::format_to(str, 128, "{}{}{}{}{}{}{}{}{}", 1, 2, 3, 4, 5, 6, 7, 8, 9);
+
+    CHECK_EQ(usf::parse_cache_stats().hits, 2);
+    CHECK_EQ(usf::parse_cache_stats().misses, 3);
+
+    // Invalid format strings are never cached, missing arguments are still
+    // detected on a hit
+    CHECK_THROWS_AS(usf::format_to(str, 128, "{:q}", 1), std::runtime_error);
+    CHECK_THROWS_AS(usf::format_to(str, 128, "{:q}", 1), std::runtime_error);
+    CHECK_THROWS_AS(usf::format_to(str, 128, "{} {}", 1), std::runtime_error);
+    CHECK_THROWS_AS(usf::format_to(str, 128, "{} {}", 1), std::runtime_error);
+
+    usf::parse_cache_clear();
+
+    // A format string rebuilt in the same memory is parsed again (miss), the
+    // cached specs don't outlive the text they were parsed from
+    char fmt[16] = "<{}>";
+    usf::format_to(str, 128, usf::StringView(fmt, 4), 1);
+    CHECK_EQ(str, "<1>");
+    std::memcpy(fmt, "[{:x}]", 6);
+    usf::format_to(str, 128, usf::StringView(fmt, 6), 255);
+    CHECK_EQ(str, "[ff]");
+    std::memcpy(fmt, "({})", 4);
+    usf::format_to(str, 128, usf::StringView(fmt, 4), 3);
+    CHECK_EQ(str, "(3)");
+    usf::format_to(str, 128, usf::StringView(fmt, 4), 4);
+    CHECK_EQ(str, "(4)");
+
+    CHECK_EQ(usf::parse_cache_stats().hits, 1);
+    CHECK_EQ(usf::parse_cache_stats().misses, 3);
+
+    // Too long to be cached: parsed on each call
+    const std::string long_fmt = std::string(USF_PARSE_CACHE_MAX_LENGTH, '-') + "{}";
+    usf::format_to(str, 128, usf::StringView(long_fmt.data(), static_cast<std::ptrdiff_t>(long_fmt.size())), 5);
+    CHECK_EQ(str, std::string(USF_PARSE_CACHE_MAX_LENGTH, '-') + "5");
+    usf::format_to(str, 128, usf::StringView(long_fmt.data(), static_cast<std::ptrdiff_t>(long_fmt.size())), 5);
+
+    CHECK_EQ(usf::parse_cache_stats().hits, 1);
+    CHECK_EQ(usf::parse_cache_stats().misses, 5);
+
+    // Not used in constant expressions
+    TEST_STATIC_ASSERT(test_format_equal("x={:x}", uint64_t{0xdeadbeefcafeU}, "x=deadbeefcafe"));
+}